@@ -0,0 +1,124 @@
+#ifndef RTW_ARGSORT_HPP
+#define RTW_ARGSORT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include <rtw/algorithm/intro_sort.hpp>
+#include <rtw/algorithm/merge_sort.hpp>
+#include <rtw/algorithm/quick_sort.hpp>
+#include <rtw/container/vector.hpp>
+
+namespace rtw{
+
+// sorts the indices of [first, last) with Sort; cheap keys are copied next to their index so that the sort
+// reads contiguous memory, other keys are compared through the index
+template<typename Index, typename RandomAccessIterator, typename Compare, typename Sort>
+rtw::vector<Index> argsort_impl(RandomAccessIterator first, RandomAccessIterator last, Compare compare, Sort sort)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    difference_type size = last - first;
+    if(static_cast<std::uintmax_t>(size) > static_cast<std::uintmax_t>(std::numeric_limits<Index>::max())){
+        throw std::length_error("length_error");
+    }
+
+    rtw::vector<Index> index(size);
+    if constexpr(rtw::use_block_partition<value_type, Compare>::value){
+        using keyed_type = std::pair<value_type, Index>;
+        rtw::vector<keyed_type> keyed(size);
+        for(difference_type i = 0; i < size; ++i){
+            keyed[i] = keyed_type(first[i], static_cast<Index>(i));
+        }
+        sort(keyed.begin(), keyed.end(), [&compare](const keyed_type& lhs, const keyed_type& rhs) -> bool {
+            return compare(lhs.first, rhs.first);
+        });
+        for(difference_type i = 0; i < size; ++i){
+            index[i] = keyed[i].second;
+        }
+    }
+    else{
+        for(difference_type i = 0; i < size; ++i){
+            index[i] = static_cast<Index>(i);
+        }
+        sort(index.begin(), index.end(), [&compare, first](Index lhs, Index rhs) -> bool {
+            return compare(first[lhs], first[rhs]);
+        });
+    }
+    return index;
+}
+
+// returns the permutation that sorts [first, last): first[index[0]], first[index[1]], ... is sorted
+template<typename Index = std::uint32_t, typename RandomAccessIterator, typename Compare>
+rtw::vector<Index> argsort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    return rtw::argsort_impl<Index>(first, last, compare, [](auto first, auto last, auto compare) -> void {
+        rtw::intro_sort(first, last, compare);
+    });
+}
+
+template<typename Index = std::uint32_t, typename RandomAccessIterator>
+rtw::vector<Index> argsort(RandomAccessIterator first, RandomAccessIterator last)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    return rtw::argsort<Index>(first, last, std::less<value_type>());
+}
+
+// argsort that keeps equal keys in the order of their indices
+template<typename Index = std::uint32_t, typename RandomAccessIterator, typename Compare>
+rtw::vector<Index> stable_argsort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    return rtw::argsort_impl<Index>(first, last, compare, [](auto first, auto last, auto compare) -> void {
+        rtw::merge_sort(first, last, compare);
+    });
+}
+
+template<typename Index = std::uint32_t, typename RandomAccessIterator>
+rtw::vector<Index> stable_argsort(RandomAccessIterator first, RandomAccessIterator last)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    return rtw::stable_argsort<Index>(first, last, std::less<value_type>());
+}
+
+template<typename Tuple, std::size_t... I, typename Size, typename... RandomAccessIterators>
+void permutation_restore(Tuple& saved, std::index_sequence<I...>, Size position, RandomAccessIterators... columns)
+{
+    ((columns[position] = std::move(std::get<I>(saved))), ...);
+}
+
+// reorders every column so that column[i] becomes the old column[index[i]], as argsort returns it.
+// Each cycle of the permutation is walked once for all columns together and holds one element per column,
+// the permutation itself is consumed: [index_first, index_last) is the identity afterwards.
+template<typename RandomAccessIterator, typename... RandomAccessIterators>
+void apply_permutation(RandomAccessIterator index_first, RandomAccessIterator index_last, RandomAccessIterators... columns)
+{
+    using index_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    index_type size = static_cast<index_type>(index_last - index_first);
+    for(index_type start = 0; start < size; ++start){
+        if(index_first[start] == start){
+            continue;
+        }
+        auto saved = std::make_tuple(std::move(columns[start])...);
+        index_type position = start;
+        while(true){
+            index_type next = index_first[position];
+            index_first[position] = position;
+            if(next == start){
+                rtw::permutation_restore(saved, std::index_sequence_for<RandomAccessIterators...>(), position, columns...);
+                break;
+            }
+            ((columns[position] = std::move(columns[next])), ...);
+            position = next;
+        }
+    }
+}
+
+} // namespace rtw
+
+#endif // RTW_ARGSORT_HPP
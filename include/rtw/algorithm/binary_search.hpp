@@ -2,13 +2,78 @@
 #define RTW_BINARY_SEARCH_HPP
 
 #include <iterator>
+#include <memory>
+#include <type_traits>
 #include <utility>
 
 namespace rtw {
 
+template<typename Iterator>
+struct is_random_access_iterator : std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>{};
+
+// asks the cache for the element it refers to, when it refers to one in memory; nothing during constant evaluation
+template<typename RandomAccessIterator>
+constexpr void prefetch(RandomAccessIterator it)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr(std::is_lvalue_reference<typename std::iterator_traits<RandomAccessIterator>::reference>::value){
+        if(!__builtin_is_constant_evaluated()){
+            __builtin_prefetch(std::addressof(*it));
+        }
+    }
+#endif
+    static_cast<void>(it);
+}
+
+// lower_bound without a branch on the comparison: the range [first, first + length) that must hold the answer keeps
+// its first element and loses the lower half of its length at each step, the new first being chosen by a conditional
+// move. Both middles the next step may look at are prefetched before this one compares, so on a large range the
+// load of the next level overlaps the comparison of this one.
+template<typename RandomAccessIterator, typename T, typename Compare>
+constexpr RandomAccessIterator branchless_lower_bound(RandomAccessIterator first, RandomAccessIterator last, const T& value, Compare compare)
+{
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    difference_type length = last - first;
+    if(length == 0){
+        return first;
+    }
+    while(length > 1){
+        difference_type half = length / 2;
+        difference_type next = (length - half) / 2;
+        rtw::prefetch(first + next);
+        rtw::prefetch(first + (half + next));
+        first = compare(first[half], value) ? first + half : first;
+        length -= half;
+    }
+    return compare(*first, value) ? first + 1 : first;
+}
+
+// upper_bound the same way
+template<typename RandomAccessIterator, typename T, typename Compare>
+constexpr RandomAccessIterator branchless_upper_bound(RandomAccessIterator first, RandomAccessIterator last, const T& value, Compare compare)
+{
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    difference_type length = last - first;
+    if(length == 0){
+        return first;
+    }
+    while(length > 1){
+        difference_type half = length / 2;
+        difference_type next = (length - half) / 2;
+        rtw::prefetch(first + next);
+        rtw::prefetch(first + (half + next));
+        first = compare(value, first[half]) ? first : first + half;
+        length -= half;
+    }
+    return compare(value, *first) ? first : first + 1;
+}
+
 template<typename ForwardIterator, typename T, typename Compare>
 constexpr ForwardIterator lower_bound(ForwardIterator first, ForwardIterator last, const T& value, Compare compare)
 {
+    if constexpr(rtw::is_random_access_iterator<ForwardIterator>::value){
+        return rtw::branchless_lower_bound(first, last, value, compare);
+    }
     using difference_type = typename std::iterator_traits<ForwardIterator>::difference_type;
     difference_type distance = std::distance(first, last);
     while(distance > 0) {
@@ -37,6 +102,9 @@ constexpr ForwardIterator lower_bound(ForwardIterator first, ForwardIterator las
 template<typename ForwardIterator, typename T, typename Compare>
 constexpr ForwardIterator upper_bound(ForwardIterator first, ForwardIterator last, const T& value, Compare compare)
 {
+    if constexpr(rtw::is_random_access_iterator<ForwardIterator>::value){
+        return rtw::branchless_upper_bound(first, last, value, compare);
+    }
     using difference_type = typename std::iterator_traits<ForwardIterator>::difference_type;
     difference_type distance = std::distance(first, last);
     while(distance > 0) {
@@ -0,0 +1,276 @@
+#ifndef RTW_BLOCK_MERGE_SORT_HPP
+#define RTW_BLOCK_MERGE_SORT_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+#include <rtw/algorithm/binary_search.hpp>
+#include <rtw/algorithm/insertion_sort.hpp>
+#include <rtw/algorithm/merge_sort.hpp>
+#include <rtw/algorithm/sort_network.hpp>
+#include <rtw/container/vector.hpp>
+
+namespace rtw {
+
+// the number of buffer elements block_merge_sort needs to merge every pair of runs of a range of size in linear time
+inline std::size_t block_merge_sort_buffer_size(std::size_t size) noexcept
+{
+    std::size_t root = static_cast<std::size_t>(std::sqrt(static_cast<double>(size)));
+    while(root * root < size){
+        ++root;
+    }
+    return root;
+}
+
+// stable merge of [first, middle) and [middle, last) that moves only the left range into buffer
+template<typename RandomAccessIterator, typename Pointer, typename Compare>
+void block_merge_forward(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, Pointer buffer, Compare compare)
+{
+    Pointer first1 = buffer;
+    Pointer last1 = std::move(first, middle, buffer);
+    while(first1 != last1 && middle != last){
+        if(compare(*middle, *first1)){
+            *first = std::move(*middle);
+            ++middle;
+        }
+        else{
+            *first = std::move(*first1);
+            ++first1;
+        }
+        ++first;
+    }
+    std::move(first1, last1, first);
+}
+
+// stable merge of [first, middle) and [middle, last) that moves only the right range into buffer
+template<typename RandomAccessIterator, typename Pointer, typename Compare>
+void block_merge_backward(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, Pointer buffer, Compare compare)
+{
+    Pointer first2 = buffer;
+    Pointer last2 = std::move(middle, last, buffer);
+    while(first2 != last2 && first != middle){
+        if(compare(*(last2 - 1), *(middle - 1))){
+            *--last = std::move(*--middle);
+        }
+        else{
+            *--last = std::move(*--last2);
+        }
+    }
+    std::move_backward(first2, last2, last);
+}
+
+// std::rotate that goes through buffer when the shorter side fits into it; returns the new position of *first
+template<typename RandomAccessIterator, typename Pointer>
+RandomAccessIterator block_merge_rotate(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, Pointer buffer, std::size_t buffer_size)
+{
+    std::size_t left = static_cast<std::size_t>(middle - first);
+    std::size_t right = static_cast<std::size_t>(last - middle);
+    if(left <= right && left <= buffer_size){
+        Pointer buffer_last = std::move(first, middle, buffer);
+        RandomAccessIterator result = std::move(middle, last, first);
+        std::move(buffer, buffer_last, result);
+        return result;
+    }
+    if(right <= buffer_size){
+        Pointer buffer_last = std::move(middle, last, buffer);
+        std::move_backward(first, middle, last);
+        std::move(buffer, buffer_last, first);
+        return first + right;
+    }
+    return std::rotate(first, middle, last);
+}
+
+// merges [first, middle) and [middle, last), both longer than block, in linear time with a buffer of block elements.
+// The left range is cut into blocks of block elements after an uneven first one, and the blocks are rolled through
+// the right range: the leftmost block swaps with the next right block until the right elements before it reach the
+// smallest remaining left block, which is then dropped there and the previously dropped block merged with the right
+// elements between them. tags hold the original index of every rolling block, so that of blocks starting with equal
+// elements the earlier one is dropped first, and needs room for (middle - first) / block of them.
+template<typename RandomAccessIterator, typename Pointer, typename Compare>
+void block_merge_roll(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, Pointer buffer, std::size_t block, std::size_t* tags, Compare compare)
+{
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    difference_type size = last - first;
+    difference_type s = static_cast<difference_type>(block);
+    difference_type count = (middle - first) / s;
+    for(difference_type i = 0; i < count; ++i){
+        tags[i] = static_cast<std::size_t>(i);
+    }
+
+    // the dropped block waiting for its merge, the right elements rolled in last, the rolling blocks and the next right block
+    difference_type a_first = 0;
+    difference_type a_last = (middle - first) - count * s;
+    difference_type b_first = a_last;
+    difference_type b_last = a_last;
+    difference_type blocks_first = a_last;
+    difference_type blocks_last = middle - first;
+    difference_type next_last = std::min(blocks_last + s, size);
+    difference_type minimum = blocks_first;
+    while(true){
+        if((b_first != b_last && !compare(first[b_last - 1], first[minimum])) || next_last == blocks_last){
+            // drop the smallest block in front of the right elements not less than its first element
+            difference_type split = rtw::lower_bound(first + b_first, first + b_last, first[minimum], compare) - first;
+            difference_type remaining = b_last - split;
+            if(minimum != blocks_first){
+                std::swap_ranges(first + blocks_first, first + blocks_first + s, first + minimum);
+                std::swap(tags[0], tags[(minimum - blocks_first) / s]);
+            }
+            rtw::block_merge_forward(first + a_first, first + a_last, first + split, buffer, compare);
+            rtw::block_merge_rotate(first + split, first + blocks_first, first + blocks_first + s, buffer, block);
+            a_first = split;
+            a_last = split + s;
+            b_first = a_last;
+            b_last = a_last + remaining;
+            blocks_first += s;
+            std::move(tags + 1, tags + count, tags);
+            if(--count == 0){
+                break;
+            }
+            minimum = blocks_first + s * (std::min_element(tags, tags + count) - tags);
+        }
+        else if(next_last - blocks_last < s){
+            // the uneven last right block goes in front of the rolling blocks at once
+            difference_type length = next_last - blocks_last;
+            rtw::block_merge_rotate(first + blocks_first, first + blocks_last, first + next_last, buffer, block);
+            b_first = blocks_first;
+            b_last = blocks_first + length;
+            blocks_first += length;
+            blocks_last += length;
+            minimum += length;
+        }
+        else{
+            // roll the leftmost block to the end by swapping it with the next right block
+            std::swap_ranges(first + blocks_first, first + blocks_first + s, first + blocks_last);
+            b_first = blocks_first;
+            b_last = blocks_first + s;
+            if(minimum == blocks_first){
+                minimum = blocks_last;
+            }
+            std::rotate(tags, tags + 1, tags + count);
+            blocks_first += s;
+            blocks_last += s;
+            next_last = std::min(next_last + s, size);
+        }
+    }
+    rtw::block_merge_forward(first + a_first, first + a_last, last, buffer, compare);
+}
+
+// stable merge of [first, middle) and [middle, last): linear through buffer when one side fits into it, linear by rolling
+// blocks when the buffer holds the square root of the left side, otherwise the longer side is halved, the matching cut of
+// the other found by binary search and the two middle parts rotated, and both halves merged the same way
+template<typename RandomAccessIterator, typename Pointer, typename Compare>
+void block_merge(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, Pointer buffer, std::size_t buffer_size, std::size_t* tags, Compare compare)
+{
+    while(first != middle && middle != last && compare(*middle, *(middle - 1))){
+        std::size_t left = static_cast<std::size_t>(middle - first);
+        std::size_t right = static_cast<std::size_t>(last - middle);
+        if(left <= buffer_size && left <= right){
+            rtw::block_merge_forward(first, middle, last, buffer, compare);
+            return;
+        }
+        if(right <= buffer_size){
+            rtw::block_merge_backward(first, middle, last, buffer, compare);
+            return;
+        }
+        std::size_t block = rtw::block_merge_sort_buffer_size(left);
+        if(block <= buffer_size){
+            rtw::block_merge_roll(first, middle, last, buffer, block, tags, compare);
+            return;
+        }
+        // halving a single element on each side would not make progress
+        if(left == 1 && right == 1){
+            std::iter_swap(first, middle);
+            return;
+        }
+
+        RandomAccessIterator cut1;
+        RandomAccessIterator cut2;
+        if(left > right){
+            cut1 = first + left / 2;
+            cut2 = rtw::lower_bound(middle, last, *cut1, compare);
+        }
+        else{
+            cut2 = middle + right / 2;
+            cut1 = rtw::upper_bound(first, middle, *cut2, compare);
+        }
+        RandomAccessIterator cut = rtw::block_merge_rotate(cut1, middle, cut2, buffer, buffer_size);
+        // recurse into the shorter half and loop on the longer one
+        if((cut1 - first) + (cut - cut1) < (cut2 - cut) + (last - cut2)){
+            rtw::block_merge(first, cut1, cut, buffer, buffer_size, tags, compare);
+            first = cut;
+            middle = cut2;
+        }
+        else{
+            rtw::block_merge(cut, cut2, last, buffer, buffer_size, tags, compare);
+            last = cut;
+            middle = cut1;
+        }
+    }
+}
+
+// stable bottom-up merge sort using only buffer_size elements of buffer: runs of merge_sort_run elements are sorted in place,
+// then adjacent runs are merged by block_merge. With block_merge_sort_buffer_size(last - first) elements every merge is
+// linear and the sort O(n log n); with fewer, merges of long runs fall back to rotations and the sort degrades towards
+// O(n log^2 n), reached without any buffer at all.
+template<typename RandomAccessIterator, typename Pointer, typename Compare>
+void block_merge_sort(RandomAccessIterator first, RandomAccessIterator last, Pointer buffer, std::size_t buffer_size, Compare compare)
+{
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    difference_type size = last - first;
+    for(difference_type low = 0; low < size; low += merge_sort_run){
+        RandomAccessIterator run_last = first + std::min<difference_type>(low + merge_sort_run, size);
+        // equal integers cannot be told apart, so the unstable network is safe for them
+        if constexpr(rtw::use_sort_network<value_type, Compare>::value && std::is_integral<value_type>::value){
+            rtw::sort_network_sort(first + low, run_last, compare);
+        }
+        else{
+            rtw::insertion_sort(first + low, run_last, compare);
+        }
+    }
+    if(size <= merge_sort_run){
+        return;
+    }
+
+    // block_merge_roll runs only with blocks of at least the square root of the left run, so this many tags always suffice
+    rtw::vector<std::size_t> tags(rtw::block_merge_sort_buffer_size(static_cast<std::size_t>(size)) + 1);
+    for(difference_type width = merge_sort_run; width < size; width *= 2){
+        for(difference_type low = 0; low + width < size; low += 2 * width){
+            difference_type high = std::min(low + 2 * width, size);
+            rtw::block_merge(first + low, first + low + width, first + high, buffer, buffer_size, &tags[0], compare);
+        }
+    }
+}
+
+// buffer_size is the scratch budget in elements, capped at what makes every merge linear
+template<typename RandomAccessIterator, typename Compare>
+void block_merge_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare, std::size_t buffer_size)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    std::size_t size = static_cast<std::size_t>(last - first);
+    buffer_size = std::min(buffer_size, rtw::block_merge_sort_buffer_size(size));
+    rtw::vector<value_type> buffer(buffer_size);
+    rtw::block_merge_sort(first, last, buffer.begin(), buffer_size, compare);
+}
+
+template<typename RandomAccessIterator, typename Compare>
+void block_merge_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    std::size_t size = static_cast<std::size_t>(last - first);
+    rtw::block_merge_sort(first, last, compare, rtw::block_merge_sort_buffer_size(size));
+}
+
+template<typename RandomAccessIterator>
+void block_merge_sort(RandomAccessIterator first, RandomAccessIterator last)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    rtw::block_merge_sort(first, last, std::less<value_type>());
+}
+
+} // namespace rtw
+
+#endif // RTW_BLOCK_MERGE_SORT_HPP
\ No newline at end of file
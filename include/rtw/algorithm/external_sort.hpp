@@ -0,0 +1,343 @@
+#ifndef RTW_EXTERNAL_SORT_HPP
+#define RTW_EXTERNAL_SORT_HPP
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <rtw/algorithm/intro_sort.hpp>
+#include <rtw/algorithm/kway_merge.hpp>
+#include <rtw/container/vector.hpp>
+
+namespace rtw{
+
+struct external_sort_options{
+    // bytes of records held in memory: run generation splits it between the chunk being sorted, the chunk being read
+    // and the chunk being written, merging between one io buffer per run and the output buffer
+    std::size_t memory_budget;
+    // directory of the temporary run files, which are unlinked as soon as they are created
+    std::string temp_directory;
+    // bytes of every sequential read or write while merging; the budget must hold at least three of them, two runs
+    // and the output
+    std::size_t io_buffer_size;
+
+    external_sort_options()
+    : memory_budget(std::size_t(256) << 20)
+    , temp_directory(std::filesystem::temp_directory_path().string())
+    , io_buffer_size(std::size_t(1) << 20){}
+};
+
+// owns a file descriptor; transfers loop until complete and failures throw std::system_error
+class external_file{
+private:
+    int fd_;
+public:
+    external_file() noexcept
+    : fd_(-1){}
+    external_file(const std::string& path, int flags, mode_t mode = 0644)
+    : fd_(::open(path.c_str(), flags | O_CLOEXEC, mode)){
+        if(fd_ < 0){
+            throw std::system_error(errno, std::generic_category(), "open " + path);
+        }
+    }
+    external_file(const external_file& other) = delete;
+    external_file(external_file&& other) noexcept
+    : fd_(other.fd_){
+        other.fd_ = -1;
+    }
+    external_file& operator=(const external_file& other) = delete;
+    external_file& operator=(external_file&& other) noexcept{
+        std::swap(fd_, other.fd_);
+        return *this;
+    }
+    ~external_file(){
+        if(fd_ >= 0){
+            ::close(fd_);
+        }
+    }
+public:
+    // an unnamed file in directory that disappears once closed
+    static external_file temporary(const std::string& directory){
+        std::string path = directory + "/rtw_external_sort_XXXXXX";
+        external_file file;
+        file.fd_ = ::mkostemp(&path[0], O_CLOEXEC);
+        if(file.fd_ < 0){
+            throw std::system_error(errno, std::generic_category(), "mkostemp " + path);
+        }
+        ::unlink(path.c_str());
+        return file;
+    }
+    std::size_t size() const{
+        struct stat status;
+        if(::fstat(fd_, &status) != 0){
+            throw std::system_error(errno, std::generic_category(), "fstat");
+        }
+        return static_cast<std::size_t>(status.st_size);
+    }
+    void read_at(void* data, std::size_t size, std::size_t offset) const{
+        char* p = static_cast<char*>(data);
+        while(size > 0){
+            ssize_t n = ::pread(fd_, p, size, static_cast<off_t>(offset));
+            if(n < 0 && errno == EINTR){
+                continue;
+            }
+            if(n <= 0){
+                throw std::system_error(n < 0 ? errno : EIO, std::generic_category(), "pread");
+            }
+            p += n;
+            size -= n;
+            offset += n;
+        }
+    }
+    void write_at(const void* data, std::size_t size, std::size_t offset){
+        const char* p = static_cast<const char*>(data);
+        while(size > 0){
+            ssize_t n = ::pwrite(fd_, p, size, static_cast<off_t>(offset));
+            if(n < 0 && errno == EINTR){
+                continue;
+            }
+            if(n <= 0){
+                throw std::system_error(n < 0 ? errno : EIO, std::generic_category(), "pwrite");
+            }
+            p += n;
+            size -= n;
+            offset += n;
+        }
+    }
+};
+
+struct external_run{
+    rtw::external_file file;
+    std::size_t count;
+};
+
+// sequential reader of one sorted run through a buffer of io records, a pull-based source of kway_merge
+template<typename Record>
+class external_run_reader{
+private:
+    const rtw::external_file* file_;
+    std::size_t offset_;
+    std::size_t remaining_;
+    rtw::vector<Record> buffer_;
+    std::size_t position_;
+    std::size_t size_;
+public:
+    external_run_reader(const rtw::external_run& run, std::size_t buffer_records)
+    : file_(&run.file)
+    , offset_(0)
+    , remaining_(run.count)
+    , buffer_(std::min(buffer_records, run.count))
+    , position_(0)
+    , size_(0){
+        refill();
+    }
+    bool empty() const noexcept{
+        return position_ == size_;
+    }
+    const Record& front() const noexcept{
+        return buffer_[position_];
+    }
+    void pop(){
+        if(++position_ == size_){
+            refill();
+        }
+    }
+private:
+    void refill(){
+        std::size_t count = std::min(buffer_.size(), remaining_);
+        if(count > 0){
+            file_->read_at(&buffer_[0], count * sizeof(Record), offset_);
+        }
+        offset_ += count * sizeof(Record);
+        remaining_ -= count;
+        position_ = 0;
+        size_ = count;
+    }
+};
+
+// sequential buffered writer
+template<typename Record>
+class external_run_writer{
+private:
+    rtw::external_file* file_;
+    std::size_t offset_;
+    rtw::vector<Record> buffer_;
+    std::size_t size_;
+public:
+    external_run_writer(rtw::external_file& file, std::size_t buffer_records)
+    : file_(&file)
+    , offset_(0)
+    , buffer_(buffer_records)
+    , size_(0){}
+    void push(const Record& record){
+        buffer_[size_++] = record;
+        if(size_ == buffer_.size()){
+            flush();
+        }
+    }
+    void flush(){
+        if(size_ > 0){
+            file_->write_at(&buffer_[0], size_ * sizeof(Record), offset_);
+            offset_ += size_ * sizeof(Record);
+            size_ = 0;
+        }
+    }
+};
+
+// output iterator appending to an external_run_writer
+template<typename Record>
+class external_run_output{
+private:
+    rtw::external_run_writer<Record>* writer_;
+public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+public:
+    explicit external_run_output(rtw::external_run_writer<Record>& writer)
+    : writer_(&writer){}
+    external_run_output& operator=(const Record& record){
+        writer_->push(record);
+        return *this;
+    }
+    external_run_output& operator*(){
+        return *this;
+    }
+    external_run_output& operator++(){
+        return *this;
+    }
+    external_run_output operator++(int){
+        return *this;
+    }
+};
+
+// merges runs [first, last) into output in one pass
+template<typename Record, typename Compare>
+void external_merge(const rtw::external_run* first, const rtw::external_run* last, rtw::external_file& output, std::size_t buffer_records, Compare compare)
+{
+    std::vector<rtw::external_run_reader<Record>> readers;
+    readers.reserve(last - first);
+    for(const rtw::external_run* run = first; run != last; ++run){
+        readers.emplace_back(*run, buffer_records);
+    }
+    rtw::external_run_writer<Record> writer(output, buffer_records);
+    rtw::kway_merge(readers.begin(), readers.end(), rtw::external_run_output<Record>(writer), compare);
+    writer.flush();
+}
+
+// sorts the fixed-size records of input_path into output_path, which may be the same file.
+// Chunks of a third of the memory budget are sorted while the next one is being read and the last one is being spilled
+// as a run, and the runs are then merged as many at a time as one io buffer each fits into the budget. The merge reads
+// and writes synchronously, through buffers large enough to keep the transfers sequential.
+template<typename Record, typename Compare>
+void external_sort(const std::string& input_path, const std::string& output_path, Compare compare, const rtw::external_sort_options& options = rtw::external_sort_options())
+{
+    static_assert(std::is_trivially_copyable<Record>::value, "records are read and written as raw bytes");
+    if(options.io_buffer_size == 0){
+        throw std::invalid_argument("io_buffer_size is zero");
+    }
+    if(options.memory_budget / 3 < options.io_buffer_size){
+        throw std::invalid_argument("memory_budget holds fewer than three io buffers");
+    }
+    std::vector<rtw::external_run> runs;
+    {
+        rtw::external_file input(input_path, O_RDONLY);
+        std::size_t bytes = input.size();
+        if(bytes % sizeof(Record) != 0){
+            throw std::invalid_argument("input size is not a multiple of the record size");
+        }
+        std::size_t records = bytes / sizeof(Record);
+
+        // everything fits: one sort and one write
+        if(bytes <= options.memory_budget){
+            rtw::vector<Record> data(records);
+            if(records > 0){
+                input.read_at(&data[0], bytes, 0);
+                rtw::intro_sort(&data[0], &data[0] + records, compare);
+            }
+            rtw::external_file output(output_path, O_WRONLY | O_CREAT | O_TRUNC);
+            if(records > 0){
+                output.write_at(&data[0], bytes, 0);
+            }
+            return;
+        }
+
+        // a chunk is sorted while the next one is read into the second buffer and the last one written from the third
+        std::size_t chunk = std::max<std::size_t>(1, options.memory_budget / 3 / sizeof(Record));
+        rtw::vector<Record> buffers[3] = { rtw::vector<Record>(chunk), rtw::vector<Record>(chunk), rtw::vector<Record>(chunk) };
+        auto read_chunk = [&input, chunk, records](Record* data, std::size_t index) -> std::size_t {
+            std::size_t count = std::min(chunk, records - index * chunk);
+            input.read_at(data, count * sizeof(Record), index * chunk * sizeof(Record));
+            return count;
+        };
+        auto write_run = [](rtw::external_file* run, const Record* data, std::size_t count){
+            run->write_at(data, count * sizeof(Record), 0);
+        };
+        // the writes refer to the run files in place
+        runs.reserve((records + chunk - 1) / chunk);
+        std::future<std::size_t> next = std::async(std::launch::async, read_chunk, &buffers[0][0], 0);
+        std::future<void> written;
+        for(std::size_t index = 0; index * chunk < records; ++index){
+            std::size_t count = next.get();
+            Record* data = &buffers[index % 3][0];
+            // into the buffer of the chunk before the last, whose write ended before the last one's began
+            if((index + 1) * chunk < records){
+                next = std::async(std::launch::async, read_chunk, &buffers[(index + 1) % 3][0], index + 1);
+            }
+            rtw::intro_sort(data, data + count, compare);
+            runs.push_back(rtw::external_run{ rtw::external_file::temporary(options.temp_directory), count });
+            if(written.valid()){
+                written.get();
+            }
+            written = std::async(std::launch::async, write_run, &runs.back().file, data, count);
+        }
+        written.get();
+    }
+
+    std::size_t buffer_records = std::max<std::size_t>(1, options.io_buffer_size / sizeof(Record));
+    std::size_t buffers = options.memory_budget / options.io_buffer_size;
+    std::size_t fan_in = buffers >= 3 ? buffers - 1 : 2;
+    while(runs.size() > fan_in){
+        std::vector<rtw::external_run> merged;
+        for(std::size_t begin = 0; begin < runs.size(); begin += fan_in){
+            std::size_t end = std::min(begin + fan_in, runs.size());
+            std::size_t count = 0;
+            for(std::size_t i = begin; i < end; ++i){
+                count += runs[i].count;
+            }
+            rtw::external_file run = rtw::external_file::temporary(options.temp_directory);
+            rtw::external_merge<Record>(runs.data() + begin, runs.data() + end, run, buffer_records, compare);
+            merged.push_back(rtw::external_run{ std::move(run), count });
+        }
+        runs = std::move(merged);
+    }
+    rtw::external_file output(output_path, O_WRONLY | O_CREAT | O_TRUNC);
+    rtw::external_merge<Record>(runs.data(), runs.data() + runs.size(), output, buffer_records, compare);
+}
+
+template<typename Record>
+void external_sort(const std::string& input_path, const std::string& output_path, const rtw::external_sort_options& options = rtw::external_sort_options())
+{
+    rtw::external_sort<Record>(input_path, output_path, std::less<Record>(), options);
+}
+
+} // namespace rtw
+
+#endif // RTW_EXTERNAL_SORT_HPP
\ No newline at end of file
@@ -0,0 +1,235 @@
+#ifndef RTW_EYTZINGER_INDEX_HPP
+#define RTW_EYTZINGER_INDEX_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <rtw/algorithm/binary_search.hpp>
+#include <rtw/container/vector.hpp>
+
+namespace rtw{
+
+// the search descends prefetching the 2^eytzinger_prefetch_levels descendants this many levels down, which lie next to
+// each other
+enum { eytzinger_prefetch_levels = 4 };
+
+// floor(log2(x)), x > 0
+inline std::size_t eytzinger_log2(std::size_t x) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(x));
+#else
+    std::size_t log = 0;
+    while(x >>= 1){
+        ++log;
+    }
+    return log;
+#endif
+}
+
+// the number of trailing ones of x
+inline std::size_t eytzinger_trailing_ones(std::size_t x) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return ~x == 0 ? sizeof(std::size_t) * 8 : static_cast<std::size_t>(__builtin_ctzll(~x));
+#else
+    std::size_t ones = 0;
+    while(x & 1){
+        x >>= 1;
+        ++ones;
+    }
+    return ones;
+#endif
+}
+
+// read-only search index over a sorted range, holding the keys in the breadth-first order of the implicit complete binary
+// search tree (Eytzinger layout): the root at 1 and the children of node k at 2k and 2k + 1. The first levels, which
+// every search passes, share a few cache lines, and the 16 descendants 16k, ..., 16k + 15 four levels below node k are
+// kept together as block k, aligned to a cache line, so prefetching the lines of one block per step hides most of the
+// misses a binary search takes on a large range. Searches return ranks in the sorted range, computed from the node
+// reached; the index holds the keys once and nothing else.
+template<typename T, typename Compare = std::less<T>>
+class eytzinger_index{
+public:
+    using value_type = T;
+    using value_compare = Compare;
+    using size_type = std::size_t;
+    using const_reference = const T&;
+    static constexpr std::size_t block_size = std::size_t(1) << eytzinger_prefetch_levels;
+    struct alignas(64) block{
+        T keys[block_size];
+    };
+private:
+    // node k in keys[k % block_size] of block k / block_size; node 0 is unused
+    rtw::vector<block> blocks_;
+    size_type size_;
+    Compare comp_;
+public:
+    // constructor
+    explicit eytzinger_index(const Compare& compare = Compare())
+    : blocks_()
+    , size_(0)
+    , comp_(compare){}
+
+    // [first, last) sorted by compare; O(n)
+    template<typename RandomAccessIterator>
+    eytzinger_index(RandomAccessIterator first, RandomAccessIterator last, const Compare& compare = Compare())
+    : blocks_((static_cast<size_type>(last - first) + block_size) / block_size)
+    , size_(static_cast<size_type>(last - first))
+    , comp_(compare){
+        build(first, size_);
+    }
+
+    explicit eytzinger_index(const rtw::vector<T>& sorted, const Compare& compare = Compare())
+    : eytzinger_index(sorted.begin(), sorted.end(), compare){}
+
+    eytzinger_index(const eytzinger_index& other) = default;
+    eytzinger_index(eytzinger_index&& other) = default;
+
+    // operator=
+    eytzinger_index& operator=(const eytzinger_index& other) = default;
+    eytzinger_index& operator=(eytzinger_index&& other) = default;
+
+    // destructor
+    ~eytzinger_index() = default;
+public:
+    // capacity
+    bool empty() const noexcept{
+        return size_ == 0;
+    }
+    size_type size() const noexcept{
+        return size_;
+    }
+
+    // element access
+    // the key of rank rank < size() in the sorted range; O(log n)
+    const_reference operator[](size_type rank) const{
+        return key(node(rank));
+    }
+
+    // lookup
+    // the rank of the first key not less than value, size() if there is none
+    size_type lower_bound(const value_type& value) const{
+        return search(value, [this](const T& key, const T& value){ return comp_(key, value); });
+    }
+    // the rank of the first key greater than value, size() if there is none
+    size_type upper_bound(const value_type& value) const{
+        return search(value, [this](const T& key, const T& value){ return !comp_(value, key); });
+    }
+    bool contains(const value_type& value) const{
+        size_type r = lower_bound(value);
+        return r != size() && !comp_(value, (*this)[r]);
+    }
+
+    void swap(eytzinger_index& other) noexcept(std::is_nothrow_swappable_v<Compare>){
+        using std::swap;
+        swap(blocks_, other.blocks_);
+        swap(size_, other.size_);
+        swap(comp_, other.comp_);
+    }
+private:
+    // unpadded blocks hold the keys back to back, so the search indexes them directly and takes no extra step per level
+    const T& key(size_type k) const{
+        if constexpr(sizeof(block) == sizeof(T) * block_size){
+            return reinterpret_cast<const T*>(blocks_.data())[k];
+        }
+        else{
+            return blocks_[k / block_size].keys[k % block_size];
+        }
+    }
+    T& key(size_type k){
+        return const_cast<T&>(static_cast<const eytzinger_index&>(*this).key(k));
+    }
+    // descends right where right(key, value), prefetching every line of the block of descendants ahead. The levels above
+    // the last are full and walked a fixed number of times, so the loop exit is always predicted; the last level, filled
+    // from the left, takes one more step by a conditional move. The walk always ends below a leaf.
+    template<typename Right>
+    size_type search(const value_type& value, Right right) const{
+        size_type n = size();
+        if(n == 0){
+            return 0;
+        }
+        const block* blocks = blocks_.data();
+        size_type last_block = blocks_.size() - 1;
+        size_type k = 1;
+        for(size_type level = eytzinger_log2(n); level > 0; --level){
+            const char* ahead = reinterpret_cast<const char*>(blocks + std::min(k, last_block));
+            for(std::size_t line = 0; line < sizeof(block); line += 64){
+                rtw::prefetch(ahead + line);
+            }
+            k = 2 * k + (right(key(k), value) ? 1 : 0);
+        }
+        size_type next = 2 * k + (right(key(k <= n ? k : 1), value) ? 1 : 0);
+        k = k <= n ? next : k;
+        return rank(k);
+    }
+    // an in-order walk of the tree takes the sorted keys in order
+    template<typename RandomAccessIterator>
+    void build(RandomAccessIterator first, size_type n){
+        // the leftmost node first
+        size_type k = 1;
+        while(2 * k <= n){
+            k *= 2;
+        }
+        for(size_type i = 0; i < n; ++i){
+            key(k) = first[i];
+            // next in order: the leftmost node of the right subtree, or the first ancestor reached from its left
+            if(2 * k + 1 <= n){
+                k = 2 * k + 1;
+                while(2 * k <= n){
+                    k *= 2;
+                }
+            }
+            else{
+                k >>= eytzinger_trailing_ones(k) + 1;
+            }
+        }
+    }
+    // the in-order rank of node k, 1 <= k <= size(). In the perfect tree with the height of this one the node at depth d
+    // and position p within its level has rank (2p + 1) 2^(height - d) - 1; the last level is filled from the left, so its
+    // slots missing before that rank are subtracted, the last level taking every other in-order position.
+    size_type perfect_rank(size_type k) const{
+        size_type height = eytzinger_log2(size());
+        size_type depth = eytzinger_log2(k);
+        size_type position = k - (size_type(1) << depth);
+        return ((2 * position + 1) << (height - depth)) - 1;
+    }
+    size_type node_rank(size_type k) const{
+        size_type n = size();
+        size_type height = eytzinger_log2(n);
+        size_type last_level = n - ((size_type(1) << height) - 1);
+        size_type r = perfect_rank(k);
+        size_type slots_before = (r + 1) / 2;
+        return slots_before > last_level ? r - (slots_before - last_level) : r;
+    }
+    // the search ended below a leaf, having turned right after the answer on the way down: the answer is where the
+    // last left turn was taken, found by dropping the trailing right turns and that left turn; nothing left means none
+    size_type rank(size_type k) const{
+        k >>= eytzinger_trailing_ones(k) + 1;
+        return k == 0 ? size() : node_rank(k);
+    }
+    // the node holding rank rank, by descending along the ranks of the subtrees
+    size_type node(size_type rank) const{
+        size_type k = 1;
+        while(true){
+            size_type r = node_rank(k);
+            if(r == rank){
+                return k;
+            }
+            k = 2 * k + (r < rank ? 1 : 0);
+        }
+    }
+};
+
+template<typename T, typename Compare>
+void swap(rtw::eytzinger_index<T, Compare>& lhs, rtw::eytzinger_index<T, Compare>& rhs) noexcept(noexcept(lhs.swap(rhs))){
+    lhs.swap(rhs);
+}
+
+} // namespace rtw
+
+#endif // RTW_EYTZINGER_INDEX_HPP
\ No newline at end of file
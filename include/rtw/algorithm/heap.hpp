@@ -1,22 +1,35 @@
 #ifndef RTW_HEAP_HPP
 #define RTW_HEAP_HPP
 
+#include <cstddef>
+#include <functional>
 #include <iterator>
+#include <utility>
 
 namespace rtw {
 
-template<typename RandomAccessIterator, typename Compare>
+// the heap algorithms keep a d-ary heap of Arity children per node, binary by default: the children of node i are
+// Arity * i + 1 to Arity * i + Arity, so they are adjacent and, for 4-ary and 8-ary heaps of small elements, fall into
+// one or two cache lines. A heap is only valid for the arity it was built with.
+template<std::size_t Arity = 2, typename RandomAccessIterator, typename Compare>
 constexpr void adjust_heap(RandomAccessIterator first, RandomAccessIterator parent, RandomAccessIterator last, Compare compare)
 {
+    static_assert(Arity >= 2, "a heap node needs at least two children");
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    constexpr difference_type arity = static_cast<difference_type>(Arity);
+    difference_type size = last - first;
     while(true){
-        RandomAccessIterator left = first + 2 * (parent - first) + 1;
-        RandomAccessIterator right = first + 2 * (parent - first) + 2;
-        RandomAccessIterator top = parent;
-        if(left < last && compare(*parent, *left)){
-            top = left;
+        difference_type child_first = arity * (parent - first) + 1;
+        if(child_first >= size){
+            return;
         }
-        if(right < last && compare(*top, *right)){
-            top = right;
+        RandomAccessIterator child = first + child_first;
+        RandomAccessIterator child_last = first + (size - child_first < arity ? size : child_first + arity);
+        RandomAccessIterator top = parent;
+        for(; child < child_last; ++child){
+            if(compare(*top, *child)){
+                top = child;
+            }
         }
         if(top == parent){
             return;
@@ -26,98 +39,138 @@ constexpr void adjust_heap(RandomAccessIterator first, RandomAccessIterator pare
     }
 }
 
-template<typename RandomAccessIterator, typename Compare>
+// sifts *parent down like adjust_heap, but bottom-up (Floyd): the hole descends to a leaf with Arity - 1 comparisons per
+// level, always taking the greatest child, and the element then climbs back from there. An element taken from the bottom
+// of the heap, as pop_heap does, ends near a leaf, so this needs about half the comparisons of adjust_heap.
+template<std::size_t Arity = 2, typename RandomAccessIterator, typename Compare>
+constexpr void adjust_heap_bottom_up(RandomAccessIterator first, RandomAccessIterator parent, RandomAccessIterator last, Compare compare)
+{
+    static_assert(Arity >= 2, "a heap node needs at least two children");
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    constexpr difference_type arity = static_cast<difference_type>(Arity);
+    difference_type size = last - first;
+    value_type value = std::move(*parent);
+    RandomAccessIterator hole = parent;
+    while(true){
+        difference_type child_first = arity * (hole - first) + 1;
+        if(child_first >= size){
+            break;
+        }
+        RandomAccessIterator child = first + child_first;
+        RandomAccessIterator child_last = first + (size - child_first < arity ? size : child_first + arity);
+        RandomAccessIterator top = child;
+        for(++child; child < child_last; ++child){
+            if(compare(*top, *child)){
+                top = child;
+            }
+        }
+        *hole = std::move(*top);
+        hole = top;
+    }
+    while(hole != parent){
+        RandomAccessIterator up = first + (hole - first - 1) / arity;
+        if(!compare(*up, value)){
+            break;
+        }
+        *hole = std::move(*up);
+        hole = up;
+    }
+    *hole = std::move(value);
+}
+
+template<std::size_t Arity = 2, typename RandomAccessIterator, typename Compare>
 constexpr void make_heap(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
 {
     if(last - first < 2){
         return;
     }
-    RandomAccessIterator parent = first + (last - first - 2) / 2;
+    RandomAccessIterator parent = first + (last - first - 2) / static_cast<std::ptrdiff_t>(Arity);
     while(first <= parent){
-        rtw::adjust_heap(first, parent, last, compare);
+        rtw::adjust_heap<Arity>(first, parent, last, compare);
         --parent;
     }
 }
 
-template<typename RandomAccessIterator>
+template<std::size_t Arity = 2, typename RandomAccessIterator>
 constexpr void make_heap(RandomAccessIterator first, RandomAccessIterator last)
 {
     using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
-    rtw::make_heap(first, last, std::less<value_type>());
+    rtw::make_heap<Arity>(first, last, std::less<value_type>());
 }
 
-template<typename RandomAccessIterator, typename Compare>
+template<std::size_t Arity = 2, typename RandomAccessIterator, typename Compare>
 inline void set_heap_key_impl(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
 {
-    RandomAccessIterator parent = first + (last - first - 1) / 2;
+    RandomAccessIterator parent = first + (last - first - 1) / static_cast<std::ptrdiff_t>(Arity);
     while(first < last && compare(*parent, *last)){
         std::iter_swap(parent, last);
         last = parent;
-        parent = first + (last - first - 1) / 2;
+        parent = first + (last - first - 1) / static_cast<std::ptrdiff_t>(Arity);
     }
 }
 
-template<typename RandomAccessIterator, typename T, typename Compare>
+template<std::size_t Arity = 2, typename RandomAccessIterator, typename T, typename Compare>
 constexpr bool set_heap_key(RandomAccessIterator first, RandomAccessIterator node, T value, Compare compare)
 {
     if(compare(value, *node)){
         return false;
     }
     *node = value;
-    rtw::set_heap_key_impl(first, node, compare);
+    rtw::set_heap_key_impl<Arity>(first, node, compare);
     return true;
 }
 
-template<typename RandomAccessIterator, typename T>
+template<std::size_t Arity = 2, typename RandomAccessIterator, typename T>
 constexpr bool set_heap_key(RandomAccessIterator first, RandomAccessIterator node, T value)
 {
     using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
-    return rtw::set_heap_key(first, node, value, std::less<value_type>());
+    return rtw::set_heap_key<Arity>(first, node, value, std::less<value_type>());
 }
 
-template<typename RandomAccessIterator, typename Compare>
+template<std::size_t Arity = 2, typename RandomAccessIterator, typename Compare>
 constexpr void push_heap(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
 {
     --last;
-    rtw::set_heap_key_impl(first, last, compare);
+    rtw::set_heap_key_impl<Arity>(first, last, compare);
 }
 
-template<typename RandomAccessIterator>
+template<std::size_t Arity = 2, typename RandomAccessIterator>
 constexpr void push_heap(RandomAccessIterator first, RandomAccessIterator last)
 {
     using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
-    rtw::push_heap(first, last, std::less<value_type>());
+    rtw::push_heap<Arity>(first, last, std::less<value_type>());
 }
 
-template<typename RandomAccessIterator, typename Compare>
+template<std::size_t Arity = 2, typename RandomAccessIterator, typename Compare>
 constexpr void pop_heap(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
 {
     --last;
     std::iter_swap(first, last);
-    rtw::adjust_heap(first, first, last, compare);
+    rtw::adjust_heap_bottom_up<Arity>(first, first, last, compare);
 }
 
-template<typename RandomAccessIterator>
+template<std::size_t Arity = 2, typename RandomAccessIterator>
 constexpr void pop_heap(RandomAccessIterator first, RandomAccessIterator last)
 {
     using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
-    rtw::pop_heap(first, last, std::less<value_type>());
+    rtw::pop_heap<Arity>(first, last, std::less<value_type>());
 }
 
-template<typename RandomAccessIterator, typename Compare>
+template<std::size_t Arity = 2, typename RandomAccessIterator, typename Compare>
 constexpr void sort_heap(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
 {
     while(last - first > 1){
-        rtw::pop_heap(first, last, compare);
+        rtw::pop_heap<Arity>(first, last, compare);
         --last;
     }
 }
 
-template<typename RandomAccessIterator>
+template<std::size_t Arity = 2, typename RandomAccessIterator>
 constexpr void sort_heap(RandomAccessIterator first, RandomAccessIterator last)
 {
     using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
-    rtw::sort_heap(first, last, std::less<value_type>());
+    rtw::sort_heap<Arity>(first, last, std::less<value_type>());
 }
 
 } // namespace rtw
@@ -1,12 +1,15 @@
 #ifndef RTW_INTRO_SORT_HPP
 #define RTW_INTRO_SORT_HPP
 
+#include <algorithm>
 #include <cmath>
 #include <type_traits>
 
 #include <rtw/algorithm/heap.hpp>
 #include <rtw/algorithm/insertion_sort.hpp>
 #include <rtw/algorithm/quick_sort.hpp>
+#include <rtw/algorithm/simd_sort.hpp>
+#include <rtw/algorithm/sort_network.hpp>
 
 namespace rtw{
 
@@ -32,13 +35,29 @@ void intro_sort_loop(RandomAccessIterator first, RandomAccessIterator last, Size
         rtw::intro_sort_loop(cut, last, depth, compare);
         last = cut;
     }
+    // leaves are finished here by a network, otherwise by the final insertion sort over the whole range
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    if constexpr(rtw::use_sort_network<value_type, Compare>::value){
+        rtw::sort_network_sort(first, last, compare);
+    }
 }
 
 template<typename RandomAccessIterator, typename Compare>
 constexpr void intro_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
 {
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    if constexpr(rtw::use_simd_sort<RandomAccessIterator, Compare>::value){
+        if(last - first > 1 && rtw::simd_sort(&*first, &*first + (last - first))){
+            if constexpr(rtw::is_greater_compare<value_type, Compare>::value){
+                std::reverse(first, last);
+            }
+            return;
+        }
+    }
     rtw::intro_sort_loop(first, last, rtw::intro_sort_depth_limit(last - first), compare);
-    rtw::insertion_sort(first, last, compare);
+    if constexpr(!rtw::use_sort_network<value_type, Compare>::value){
+        rtw::insertion_sort(first, last, compare);
+    }
 }
 
 template<typename RandomAccessIterator>
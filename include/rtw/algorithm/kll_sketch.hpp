@@ -0,0 +1,267 @@
+#ifndef RTW_KLL_SKETCH_HPP
+#define RTW_KLL_SKETCH_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <rtw/algorithm/intro_sort.hpp>
+#include <rtw/container/vector.hpp>
+
+namespace rtw{
+
+// streaming quantile sketch of Karnin, Lang and Liberty (KLL). Items are kept in levels, an item of level h standing
+// for 2^h items of the stream. When the sketch holds more than its capacity, the lowest level at or over its own
+// capacity is compacted: sorted, and every other item, starting at a random one of the first two, moved up a level.
+// The top level holds k items and every level below two thirds of the one above, at least min_width items,
+// so about 3k items are retained for any stream length.
+//
+// Inserts cost O(log k) amortized, which does not grow with the stream; levels above 0 are kept sorted, so only
+// level 0 is ever sorted. Two sketches merge level by level into one of the same guarantees. rank and quantile are
+// off by at most normalized_rank_error(k) of the stream length with 99% confidence, about 1.3% for the default k.
+template<typename T, typename Compare = std::less<T>>
+class kll_sketch{
+public:
+    using value_type = T;
+    using value_compare = Compare;
+    using size_type = std::size_t;
+    using const_reference = const T&;
+    enum { default_k = 200, min_width = 8 };
+private:
+    rtw::vector<rtw::vector<T>> levels_;
+    size_type k_;
+    size_type count_;
+    size_type retained_;
+    size_type capacity_;
+    T min_;
+    T max_;
+    std::uint64_t random_;
+    Compare comp_;
+public:
+    // constructor
+    explicit kll_sketch(size_type k = default_k, const Compare& compare = Compare(), std::uint64_t seed = 0x9e3779b97f4a7c15ULL)
+    : levels_(1)
+    , k_(k < min_width ? static_cast<size_type>(min_width) : k)
+    , count_(0)
+    , retained_(0)
+    , capacity_(k_)
+    , min_()
+    , max_()
+    , random_(seed != 0 ? seed : 1)
+    , comp_(compare){}
+
+    kll_sketch(const kll_sketch& other) = default;
+    kll_sketch(kll_sketch&& other) = default;
+
+    // operator=
+    kll_sketch& operator=(const kll_sketch& other) = default;
+    kll_sketch& operator=(kll_sketch&& other) = default;
+
+    // destructor
+    ~kll_sketch() = default;
+public:
+    // the rank error with 99% confidence as a fraction of the stream length, as fitted for the KLL sketch of
+    // Apache DataSketches, which compacts the same way
+    static double normalized_rank_error(size_type k){
+        return 2.296 / std::pow(static_cast<double>(k), 0.9723);
+    }
+
+    // capacity
+    bool empty() const noexcept{
+        return count_ == 0;
+    }
+    // the number of items inserted into this sketch and the sketches merged into it
+    size_type size() const noexcept{
+        return count_;
+    }
+    // the number of items held
+    size_type retained() const noexcept{
+        return retained_;
+    }
+    size_type k() const noexcept{
+        return k_;
+    }
+
+    // element access, exact
+    const_reference min() const{
+        return min_;
+    }
+    const_reference max() const{
+        return max_;
+    }
+
+    // modifiers
+    void insert(const value_type& value){
+        update_extremes(value, value);
+        levels_[0].push_back(value);
+        ++count_;
+        if(++retained_ > capacity_){
+            compress();
+        }
+    }
+    // afterwards this sketch summarizes both streams
+    void merge(const kll_sketch& other){
+        if(&other == this){
+            kll_sketch copy(other);
+            merge(copy);
+            return;
+        }
+        if(other.empty()){
+            return;
+        }
+        update_extremes(other.min_, other.max_);
+        while(levels_.size() < other.levels_.size()){
+            levels_.push_back(rtw::vector<T>());
+        }
+        capacity_ = capacity();
+        levels_[0].insert(levels_[0].end(), other.levels_[0].begin(), other.levels_[0].end());
+        for(size_type h = 1; h < other.levels_.size(); ++h){
+            merge_into(h, other.levels_[h].begin(), other.levels_[h].end());
+        }
+        count_ += other.count_;
+        retained_ += other.retained_;
+        compress();
+    }
+    void clear() noexcept{
+        levels_.resize(1);
+        levels_[0].clear();
+        count_ = 0;
+        retained_ = 0;
+        capacity_ = k_;
+    }
+    void swap(kll_sketch& other) noexcept(std::is_nothrow_swappable_v<Compare> && std::is_nothrow_swappable_v<T>){
+        using std::swap;
+        swap(levels_, other.levels_);
+        swap(k_, other.k_);
+        swap(count_, other.count_);
+        swap(retained_, other.retained_);
+        swap(capacity_, other.capacity_);
+        swap(min_, other.min_);
+        swap(max_, other.max_);
+        swap(random_, other.random_);
+        swap(comp_, other.comp_);
+    }
+
+    // queries
+    // the estimated fraction of the stream that is less than value
+    double rank(const value_type& value) const{
+        if(empty()){
+            return 0.0;
+        }
+        size_type less = 0;
+        for(size_type h = 0; h < levels_.size(); ++h){
+            for(const T& item : levels_[h]){
+                less += comp_(item, value) ? (size_type(1) << h) : 0;
+            }
+        }
+        return static_cast<double>(less) / static_cast<double>(count_);
+    }
+    // an item whose estimated rank is fraction of the stream: the least item that fraction of the stream does not
+    // exceed, the exact minimum and maximum at 0 and 1; the sketch must not be empty
+    value_type quantile(double fraction) const{
+        if(fraction <= 0.0){
+            return min_;
+        }
+        if(fraction >= 1.0){
+            return max_;
+        }
+        rtw::vector<std::pair<T, size_type>> items;
+        items.reserve(retained_);
+        for(size_type h = 0; h < levels_.size(); ++h){
+            for(const T& item : levels_[h]){
+                items.push_back(std::make_pair(item, size_type(1) << h));
+            }
+        }
+        const Compare& compare = comp_;
+        rtw::intro_sort(items.begin(), items.end(), [&compare](const std::pair<T, size_type>& lhs, const std::pair<T, size_type>& rhs){
+            return compare(lhs.first, rhs.first);
+        });
+        double target = fraction * static_cast<double>(count_);
+        size_type weight = 0;
+        for(const std::pair<T, size_type>& item : items){
+            weight += item.second;
+            if(static_cast<double>(weight) > target){
+                return item.first;
+            }
+        }
+        return max_;
+    }
+private:
+    void update_extremes(const value_type& min, const value_type& max){
+        if(empty() || comp_(min, min_)){
+            min_ = min;
+        }
+        if(empty() || comp_(max_, max)){
+            max_ = max;
+        }
+    }
+    // the top level holds k items, each level below two thirds of the one above
+    size_type level_capacity(size_type h) const{
+        double capacity = static_cast<double>(k_) * std::pow(2.0 / 3.0, static_cast<double>(levels_.size() - 1 - h));
+        return std::max(static_cast<size_type>(min_width), static_cast<size_type>(std::ceil(capacity)));
+    }
+    size_type capacity() const{
+        size_type capacity = 0;
+        for(size_type h = 0; h < levels_.size(); ++h){
+            capacity += level_capacity(h);
+        }
+        return capacity;
+    }
+    // xorshift64, one bit per compaction
+    bool random_bit(){
+        random_ ^= random_ << 13;
+        random_ ^= random_ >> 7;
+        random_ ^= random_ << 17;
+        return (random_ >> 63) != 0;
+    }
+    // level h >= 1 is sorted and stays so
+    template<typename Iterator>
+    void merge_into(size_type h, Iterator first, Iterator last){
+        rtw::vector<T>& level = levels_[h];
+        rtw::vector<T> merged(level.size() + static_cast<size_type>(last - first));
+        std::merge(std::make_move_iterator(level.begin()), std::make_move_iterator(level.end()), first, last, merged.begin(), comp_);
+        level.swap(merged);
+    }
+    void compress(){
+        while(retained_ > capacity_){
+            size_type h = 0;
+            while(levels_[h].size() < level_capacity(h)){
+                ++h;
+            }
+            if(h + 1 == levels_.size()){
+                levels_.push_back(rtw::vector<T>());
+                capacity_ = capacity();
+            }
+            compact(h);
+        }
+    }
+    // half of level h goes up to level h + 1; of an odd number of items the least stays behind
+    void compact(size_type h){
+        rtw::vector<T>& level = levels_[h];
+        if(h == 0){
+            rtw::intro_sort(level.begin(), level.end(), comp_);
+        }
+        size_type odd = level.size() % 2;
+        rtw::vector<T> survivors;
+        survivors.reserve(level.size() / 2);
+        for(size_type i = odd + (random_bit() ? 1 : 0); i < level.size(); i += 2){
+            survivors.push_back(std::move(level[i]));
+        }
+        retained_ -= level.size() - odd - survivors.size();
+        level.erase(level.begin() + static_cast<std::ptrdiff_t>(odd), level.end());
+        merge_into(h + 1, std::make_move_iterator(survivors.begin()), std::make_move_iterator(survivors.end()));
+    }
+};
+
+template<typename T, typename Compare>
+void swap(rtw::kll_sketch<T, Compare>& lhs, rtw::kll_sketch<T, Compare>& rhs) noexcept(noexcept(lhs.swap(rhs))){
+    lhs.swap(rhs);
+}
+
+} // namespace rtw
+
+#endif // RTW_KLL_SKETCH_HPP
\ No newline at end of file
@@ -0,0 +1,115 @@
+#ifndef RTW_KWAY_MERGE_HPP
+#define RTW_KWAY_MERGE_HPP
+
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <rtw/container/loser_tree.hpp>
+#include <rtw/container/vector.hpp>
+
+namespace rtw{
+
+// a pull-based source hands out its elements through empty(), front() and pop(), as rtw::queue does
+template<typename T, typename = void>
+struct is_kway_source : std::false_type{};
+
+template<typename T>
+struct is_kway_source<T, std::void_t<decltype(std::declval<T&>().empty()), decltype(std::declval<T&>().front()), decltype(std::declval<T&>().pop())>> : std::true_type{};
+
+// any other input is an iterator range: a std::pair of iterators or something with begin() and end()
+template<typename Iterator>
+Iterator kway_range_begin(const std::pair<Iterator, Iterator>& range)
+{
+    return range.first;
+}
+
+template<typename Iterator>
+Iterator kway_range_end(const std::pair<Iterator, Iterator>& range)
+{
+    return range.second;
+}
+
+template<typename Range>
+auto kway_range_begin(Range& range) -> decltype(std::begin(range))
+{
+    return std::begin(range);
+}
+
+template<typename Range>
+auto kway_range_end(Range& range) -> decltype(std::end(range))
+{
+    return std::end(range);
+}
+
+// merges the sorted inputs [first, last) into result in one pass with a loser tree, about log2(k) comparisons per element.
+// Equal elements keep the order of their inputs. Ranges are copied from, sources are moved from and drained.
+template<typename InputIterator, typename OutputIterator, typename Compare>
+OutputIterator kway_merge(InputIterator first, InputIterator last, OutputIterator result, Compare compare)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    if constexpr(rtw::is_kway_source<input_type>::value){
+        auto less = [&compare](input_type* lhs, input_type* rhs) -> bool {
+            return compare(lhs->front(), rhs->front());
+        };
+        rtw::vector<input_type*> sources;
+        for(; first != last; ++first){
+            if(!(*first).empty()){
+                sources.push_back(&*first);
+            }
+        }
+        rtw::loser_tree<input_type*, decltype(less)> tree(sources.begin(), sources.end(), less);
+        while(!tree.empty()){
+            input_type* source = tree.top();
+            *result = std::move(source->front());
+            ++result;
+            source->pop();
+            if(source->empty()){
+                tree.pop();
+            }
+            else{
+                tree.replace_top(source);
+            }
+        }
+    }
+    else{
+        using iterator = decltype(rtw::kway_range_begin(*first));
+        auto less = [&compare](const iterator& lhs, const iterator& rhs) -> bool {
+            return compare(*lhs, *rhs);
+        };
+        rtw::vector<iterator> begins;
+        rtw::vector<iterator> ends;
+        for(; first != last; ++first){
+            iterator begin = rtw::kway_range_begin(*first);
+            iterator end = rtw::kway_range_end(*first);
+            if(begin != end){
+                begins.push_back(begin);
+                ends.push_back(end);
+            }
+        }
+        rtw::loser_tree<iterator, decltype(less)> tree(begins.begin(), begins.end(), less);
+        while(!tree.empty()){
+            iterator current = tree.top();
+            *result = *current;
+            ++result;
+            if(++current == ends[tree.top_source()]){
+                tree.pop();
+            }
+            else{
+                tree.replace_top(current);
+            }
+        }
+    }
+    return result;
+}
+
+template<typename InputIterator, typename OutputIterator>
+OutputIterator kway_merge(InputIterator first, InputIterator last, OutputIterator result)
+{
+    return rtw::kway_merge(first, last, result, std::less<>());
+}
+
+} // namespace rtw
+
+#endif // RTW_KWAY_MERGE_HPP
\ No newline at end of file
@@ -3,11 +3,17 @@
 
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
 
+#include <rtw/algorithm/insertion_sort.hpp>
+#include <rtw/algorithm/sort_network.hpp>
 #include <rtw/container/vector.hpp>
 
 namespace rtw {
 
+// length of the runs that are insertion sorted before the first merge pass
+enum { merge_sort_run = sort_network_max };
+
 template<typename ForwardIterator, typename Pointer, typename Compare>
 void merge(ForwardIterator first, ForwardIterator middle, ForwardIterator last, Pointer buffer, Compare compare)
 {
@@ -17,28 +23,87 @@ void merge(ForwardIterator first, ForwardIterator middle, ForwardIterator last,
     Pointer last2 = first2 + std::distance(middle, last);
     std::move(first, last, buffer);
     while(first1 != last1 && first2 != last2){
-        if(compare(*first1, *first2)){
-            *first = std::move(*first1);
-            ++first1;
-        }
-        else{
+        if(compare(*first2, *first1)){
             *first = std::move(*first2);
             ++first2;
         }
+        else{
+            *first = std::move(*first1);
+            ++first1;
+        }
         ++first;
     }
     std::move(first1, last1, first);
     std::move(first2, last2, first);
 }
 
+// stable merge that moves both ranges into result, which must not overlap them
+template<typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+OutputIterator merge_move(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare compare)
+{
+    while(first1 != last1 && first2 != last2){
+        if(compare(*first2, *first1)){
+            *result = std::move(*first2);
+            ++first2;
+        }
+        else{
+            *result = std::move(*first1);
+            ++first1;
+        }
+        ++result;
+    }
+    result = std::move(first1, last1, result);
+    return std::move(first2, last2, result);
+}
+
+// merges every pair of adjacent sorted runs of length width in [source, source + size) into destination;
+// a pair that is already in order is moved as a whole without comparing its elements
+template<typename InputIterator, typename OutputIterator, typename Size, typename Compare>
+void merge_sort_pass(InputIterator source, Size size, OutputIterator destination, Size width, Compare compare)
+{
+    for(Size low = 0; low < size; low += 2 * width){
+        Size middle = std::min(low + width, size);
+        Size high = std::min(middle + width, size);
+        if(middle == high || !compare(source[middle], source[middle - 1])){
+            std::move(source + low, source + high, destination + low);
+        }
+        else{
+            rtw::merge_move(source + low, source + middle, source + middle, source + high, destination + low, compare);
+        }
+    }
+}
+
+// bottom-up merge sort: runs of merge_sort_run elements are sorted in place by insertion sort or a network, then every pass
+// merges them from the range into buffer or back, so each pass moves every element exactly once
 template<typename RandomAccessIterator, typename Pointer, typename Compare>
 void merge_sort(RandomAccessIterator first, RandomAccessIterator last, Pointer buffer, Compare compare)
 {
-    if(last - first > 1){
-        RandomAccessIterator middle = first + (last - first) / 2;
-        rtw::merge_sort(first, middle, buffer, compare);
-        rtw::merge_sort(middle, last, buffer, compare);
-        rtw::merge(first, middle, last, buffer, compare);
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    difference_type size = last - first;
+    for(difference_type low = 0; low < size; low += merge_sort_run){
+        RandomAccessIterator run_last = first + std::min<difference_type>(low + merge_sort_run, size);
+        // equal integers cannot be told apart, so the unstable network is safe for them
+        if constexpr(rtw::use_sort_network<value_type, Compare>::value && std::is_integral<value_type>::value){
+            rtw::sort_network_sort(first + low, run_last, compare);
+        }
+        else{
+            rtw::insertion_sort(first + low, run_last, compare);
+        }
+    }
+
+    bool in_buffer = false;
+    for(difference_type width = merge_sort_run; width < size; width *= 2){
+        if(in_buffer){
+            rtw::merge_sort_pass(buffer, size, first, width, compare);
+        }
+        else{
+            rtw::merge_sort_pass(first, size, buffer, width, compare);
+        }
+        in_buffer = !in_buffer;
+    }
+    if(in_buffer){
+        std::move(buffer, buffer + size, first);
     }
 }
 
@@ -1,16 +1,33 @@
 #ifndef RTW_ORDER_STATISTIC_HPP
 #define RTW_ORDER_STATISTIC_HPP
 
+#include <algorithm>
+#include <cmath>
 #include <iterator>
 #include <utility>
 
+#include <rtw/algorithm/insertion_sort.hpp>
+#include <rtw/algorithm/intro_sort.hpp>
 #include <rtw/algorithm/quick_sort.hpp>
+#include <rtw/algorithm/simd_sort.hpp>
+#include <rtw/container/vector.hpp>
 
 namespace rtw {
 
 template<typename ForwardIterator, typename Compare>
 ForwardIterator min_element(ForwardIterator first, ForwardIterator last, Compare compare)
 {
+    using value_type = typename std::iterator_traits<ForwardIterator>::value_type;
+    if constexpr(rtw::use_simd_sort<ForwardIterator, Compare>::value){
+        if(first != last){
+            const value_type* begin = &*first;
+            const value_type* result = begin;
+            // the first least element under std::greater is the first greatest one under std::less
+            if(rtw::simd_extremum_element<rtw::is_greater_compare<value_type, Compare>::value>(begin, begin + (last - first), result)){
+                return first + (result - begin);
+            }
+        }
+    }
     if(first == last){
         return first;
     }
@@ -35,6 +52,16 @@ ForwardIterator min_element(ForwardIterator first, ForwardIterator last)
 template<typename ForwardIterator, typename Compare>
 ForwardIterator max_element(ForwardIterator first, ForwardIterator last, Compare compare)
 {
+    using value_type = typename std::iterator_traits<ForwardIterator>::value_type;
+    if constexpr(rtw::use_simd_sort<ForwardIterator, Compare>::value){
+        if(first != last){
+            const value_type* begin = &*first;
+            const value_type* result = begin;
+            if(rtw::simd_extremum_element<!rtw::is_greater_compare<value_type, Compare>::value>(begin, begin + (last - first), result)){
+                return first + (result - begin);
+            }
+        }
+    }
     if(first == last){
         return first;
     }
@@ -59,20 +86,39 @@ ForwardIterator max_element(ForwardIterator first, ForwardIterator last)
 template<typename ForwardIterator, typename Compare>
 std::pair<ForwardIterator, ForwardIterator> minmax_element(ForwardIterator first, ForwardIterator last, Compare compare)
 {
+    using value_type = typename std::iterator_traits<ForwardIterator>::value_type;
+    if constexpr(rtw::use_simd_sort<ForwardIterator, Compare>::value){
+        if(first != last){
+            const value_type* begin = &*first;
+            const value_type* min = begin;
+            const value_type* max = begin;
+            if(rtw::simd_minmax_element(begin, begin + (last - first), min, max)){
+                if constexpr(rtw::is_greater_compare<value_type, Compare>::value){
+                    std::swap(min, max);
+                }
+                return std::make_pair(first + (min - begin), first + (max - begin));
+            }
+        }
+    }
+    if(first == last){
+        return std::make_pair(first, first);
+    }
     ForwardIterator next = first;
     ++next;
-    if(first == last || next == last){
+    if(next == last){
         return std::make_pair(first, first);
     }
+    // elements are taken in pairs, the smaller one only competing for the minimum and the greater one for the maximum;
+    // of equal elements the first is kept for both
     ForwardIterator min, max;
-    if(compare(*first, *next)){
-        min = first;
-        max = next;
-    }
-    else{
+    if(compare(*next, *first)){
         min = next;
         max = first;
     }
+    else{
+        min = first;
+        max = compare(*first, *next) ? next : first;
+    }
     first = next;
     ++first;
     while(first != last){
@@ -87,15 +133,7 @@ std::pair<ForwardIterator, ForwardIterator> minmax_element(ForwardIterator first
             }
             break;
         }
-        if(compare(*first, *next)){
-            if(compare(*first, *min)){
-                min = first;
-            }
-            if(compare(*max, *next)){
-                max = next;
-            }
-        }
-        else{
+        if(compare(*next, *first)){
             if(compare(*next, *min)){
                 min = next;
             }
@@ -103,6 +141,14 @@ std::pair<ForwardIterator, ForwardIterator> minmax_element(ForwardIterator first
                 max = first;
             }
         }
+        else{
+            if(compare(*first, *min)){
+                min = first;
+            }
+            if(compare(*max, *next)){
+                max = compare(*first, *next) ? next : first;
+            }
+        }
         first = next;
         ++first;
     }
@@ -116,11 +162,51 @@ std::pair<ForwardIterator, ForwardIterator> minmax_element(ForwardIterator first
     return rtw::minmax_element(first, last, std::less<value_type>());
 }
 
+// ranges of at most nth_element_insertion_threshold elements are finished by insertion sort; from
+// nth_element_sample_threshold on, the pivot is selected from a sample around nth first (Floyd-Rivest)
+enum { nth_element_insertion_threshold = 16, nth_element_sample_threshold = 600 };
+
+// moves to *first an element with at least about 3/10 of [first, last) on either side: the median of the medians of
+// groups of five, which are gathered at the front and selected from in linear time themselves
 template<typename RandomAccessIterator, typename Compare>
-void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, Compare compare)
+void median_of_medians_pivot(RandomAccessIterator first, RandomAccessIterator last, Compare compare);
+
+// introselect: partitions until nth is reached, giving up on the fast pivots once the lengths partitioned exceed budget,
+// after which every pivot is a median of medians and the rest of the selection is linear in the worst case
+template<typename RandomAccessIterator, typename Compare>
+void nth_element_loop(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, Compare compare, typename std::iterator_traits<RandomAccessIterator>::difference_type budget)
 {
-    while(last - first > 1){
-        RandomAccessIterator cut = rtw::partition_pivot(first, last, compare);
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    while(last - first > nth_element_insertion_threshold){
+        difference_type size = last - first;
+        RandomAccessIterator cut;
+        if(budget < size){
+            rtw::median_of_medians_pivot(first, last, compare);
+            cut = rtw::partition(first, last, compare);
+        }
+        else if(size >= nth_element_sample_threshold){
+            budget -= size;
+            // select nth within a block around it of about size^(2/3) elements, then partition the whole range by that element
+            double n = static_cast<double>(size);
+            double i = static_cast<double>(nth - first + 1);
+            double z = std::log(n);
+            double s = 0.5 * std::exp(2.0 * z / 3.0);
+            double sd = 0.5 * std::sqrt(z * s * (n - s) / n) * (i < n / 2 ? -1.0 : 1.0);
+            difference_type sample_first = std::max<difference_type>(0, std::min<difference_type>(nth - first, static_cast<difference_type>(i - i * s / n + sd) - 1));
+            difference_type sample_last = std::min<difference_type>(size, std::max<difference_type>(nth - first + 1, static_cast<difference_type>(i + (n - i) * s / n + sd)));
+            // the block is filled with elements spread evenly over the range, so that it is a sample of presorted input too
+            difference_type sample_size = sample_last - sample_first;
+            for(difference_type j = 0; j < sample_size; ++j){
+                std::iter_swap(first + sample_first + j, first + j * size / sample_size);
+            }
+            rtw::nth_element_loop(first + sample_first, nth, first + sample_last, compare, 4 * sample_size);
+            std::iter_swap(first, nth);
+            cut = rtw::partition(first, last, compare);
+        }
+        else{
+            budget -= size;
+            cut = rtw::partition_pivot(first, last, compare);
+        }
         if(cut <= nth){
             first = cut;
         }
@@ -128,6 +214,45 @@ void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAcc
             last = cut;
         }
     }
+    rtw::insertion_sort(first, last, compare);
+}
+
+template<typename RandomAccessIterator, typename Compare>
+void median_of_medians_pivot(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    difference_type groups = (last - first) / 5;
+    for(difference_type g = 0; g < groups; ++g){
+        RandomAccessIterator group = first + 5 * g;
+        rtw::insertion_sort(group, group + 5, compare);
+        std::iter_swap(first + g, group + 2);
+    }
+    rtw::nth_element_loop(first, first + groups / 2, first + groups, compare, 0);
+    std::iter_swap(first, first + groups / 2);
+}
+
+template<typename RandomAccessIterator, typename Compare>
+void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, Compare compare)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    if constexpr(rtw::use_simd_sort<RandomAccessIterator, Compare>::value){
+        if(last - first > 1){
+            value_type* begin = &*first;
+            value_type* end = begin + (last - first);
+            // a descending nth element is the ascending one counted from the back, then the range is reversed
+            value_type* target = rtw::is_greater_compare<value_type, Compare>::value ? end - 1 - (nth - first) : begin + (nth - first);
+            if(nth != last && rtw::simd_nth_element(begin, target, end)){
+                if constexpr(rtw::is_greater_compare<value_type, Compare>::value){
+                    std::reverse(first, last);
+                }
+                return;
+            }
+        }
+    }
+    if(nth == last){
+        return;
+    }
+    rtw::nth_element_loop(first, nth, last, compare, 4 * (last - first));
 }
 
 template<typename RandomAccessIterator>
@@ -137,6 +262,48 @@ void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAcc
     rtw::nth_element(first, nth, last, std::less<value_type>());
 }
 
+// places the element of every position of [positions_first, positions_last), offsets from first in any order, where a
+// full sort would put it, with everything between two of them in between: the middle requested position is selected,
+// which partitions the range, and each side recurses with only the positions inside it, so the cost is about
+// O(n log k) for k distinct positions rather than O(n k)
+template<typename RandomAccessIterator, typename Offset, typename Compare>
+void nth_elements_loop(RandomAccessIterator first, RandomAccessIterator last, const Offset* positions_first, const Offset* positions_last, Offset base, Compare compare)
+{
+    while(positions_first != positions_last){
+        const Offset* middle = positions_first + (positions_last - positions_first) / 2;
+        RandomAccessIterator nth = first + (*middle - base);
+        rtw::nth_element(first, nth, last, compare);
+        rtw::nth_elements_loop(first, nth, positions_first, middle, base, compare);
+        base = *middle + 1;
+        first = nth + 1;
+        positions_first = middle + 1;
+    }
+}
+
+template<typename RandomAccessIterator, typename ForwardIterator, typename Compare>
+void nth_elements(RandomAccessIterator first, RandomAccessIterator last, ForwardIterator positions_first, ForwardIterator positions_last, Compare compare)
+{
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    rtw::vector<difference_type> positions;
+    for(; positions_first != positions_last; ++positions_first){
+        positions.push_back(static_cast<difference_type>(*positions_first));
+    }
+    if(positions.empty()){
+        return;
+    }
+    rtw::intro_sort(positions.begin(), positions.end());
+    positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+    const difference_type* data = &positions[0];
+    rtw::nth_elements_loop(first, last, data, data + positions.size(), difference_type(0), compare);
+}
+
+template<typename RandomAccessIterator, typename ForwardIterator>
+void nth_elements(RandomAccessIterator first, RandomAccessIterator last, ForwardIterator positions_first, ForwardIterator positions_last)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    rtw::nth_elements(first, last, positions_first, positions_last, std::less<value_type>());
+}
+
 } // namespace rtw
 
 #endif // RTW_ORDER_STATISTIC_HPP
\ No newline at end of file
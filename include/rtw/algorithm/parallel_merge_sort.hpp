@@ -0,0 +1,136 @@
+#ifndef RTW_PARALLEL_MERGE_SORT_HPP
+#define RTW_PARALLEL_MERGE_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+
+#include <rtw/algorithm/merge_sort.hpp>
+#include <rtw/container/vector.hpp>
+#include <rtw/thread/thread_pool.hpp>
+
+namespace rtw{
+
+// ranges up to parallel_merge_sort_threshold are sorted serially, merges are cut into chunks of at least parallel_merge_grain
+enum { parallel_merge_sort_threshold = 1 << 13, parallel_merge_grain = 1 << 13 };
+
+// returns how many of the first k elements of the stable merge of [first1, first1 + size1) and [first2, first2 + size2) come from the first range
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename Compare>
+Size co_rank(Size k, RandomAccessIterator1 first1, Size size1, RandomAccessIterator2 first2, Size size2, Compare compare)
+{
+    Size low = k > size2 ? k - size2 : 0;
+    Size high = k < size1 ? k : size1;
+    while(low < high){
+        Size i = low + (high - low) / 2;
+        Size j = k - i;
+        // first1[i] goes before first2[j - 1], so more elements of the first range are needed
+        if(i < size1 && j > 0 && !compare(first2[j - 1], first1[i])){
+            low = i + 1;
+        }
+        else{
+            high = i;
+        }
+    }
+    return low;
+}
+
+// merges [first1, first1 + size1) and [first2, first2 + size2) into result, each chunk of the output is merged by its own task
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename Compare>
+void parallel_merge(rtw::thread_pool& pool, RandomAccessIterator1 first1, Size size1, RandomAccessIterator1 first2, Size size2, RandomAccessIterator2 result, Compare compare)
+{
+    Size size = size1 + size2;
+    Size chunks = std::min<Size>(size / parallel_merge_grain, static_cast<Size>(pool.size()) * 4);
+    if(chunks < 2){
+        rtw::merge_move(first1, first1 + size1, first2, first2 + size2, result, compare);
+        return;
+    }
+    rtw::task_group group(pool);
+    for(Size chunk = 0; chunk < chunks; ++chunk){
+        group.run([=]() -> void {
+            Size k0 = size * chunk / chunks;
+            Size k1 = size * (chunk + 1) / chunks;
+            Size i0 = rtw::co_rank(k0, first1, size1, first2, size2, compare);
+            Size i1 = rtw::co_rank(k1, first1, size1, first2, size2, compare);
+            rtw::merge_move(first1 + i0, first1 + i1, first2 + (k0 - i0), first2 + (k1 - i1), result + k0, compare);
+        });
+    }
+    group.wait();
+}
+
+// sorts [first, last) into [first, last) or, when into_buffer is set, into the same positions of buffer;
+// the halves are sorted into the other array so that every level moves the elements exactly once
+template<typename RandomAccessIterator, typename Pointer, typename Compare>
+void parallel_merge_sort_impl(rtw::thread_pool& pool, RandomAccessIterator first, RandomAccessIterator last, Pointer buffer, bool into_buffer, Compare compare)
+{
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    difference_type size = last - first;
+    if(size <= parallel_merge_sort_threshold){
+        rtw::merge_sort(first, last, buffer, compare);
+        if(into_buffer){
+            std::move(first, last, buffer);
+        }
+        return;
+    }
+    difference_type half = size / 2;
+    RandomAccessIterator middle = first + half;
+    {
+        rtw::task_group group(pool);
+        group.run([=, &pool]() -> void {
+            rtw::parallel_merge_sort_impl(pool, first, middle, buffer, !into_buffer, compare);
+        });
+        rtw::parallel_merge_sort_impl(pool, middle, last, buffer + half, !into_buffer, compare);
+        group.wait();
+    }
+    if(into_buffer){
+        rtw::parallel_merge(pool, first, half, middle, size - half, buffer, compare);
+    }
+    else{
+        rtw::parallel_merge(pool, buffer, half, buffer + half, size - half, first, compare);
+    }
+}
+
+template<typename RandomAccessIterator, typename Pointer, typename Compare>
+void parallel_merge_sort(rtw::thread_pool& pool, RandomAccessIterator first, RandomAccessIterator last, Pointer buffer, Compare compare)
+{
+    rtw::parallel_merge_sort_impl(pool, first, last, buffer, false, compare);
+}
+
+template<typename RandomAccessIterator, typename Compare>
+void parallel_merge_sort(rtw::thread_pool& pool, RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    difference_type distance = std::distance(first, last);
+    rtw::vector<value_type> buffer(distance);
+    rtw::parallel_merge_sort(pool, first, last, buffer.begin(), compare);
+}
+
+template<typename RandomAccessIterator>
+void parallel_merge_sort(rtw::thread_pool& pool, RandomAccessIterator first, RandomAccessIterator last)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    rtw::parallel_merge_sort(pool, first, last, std::less<value_type>());
+}
+
+template<typename RandomAccessIterator, typename Compare>
+void parallel_merge_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    if(last - first <= parallel_merge_sort_threshold){
+        rtw::merge_sort(first, last, compare);
+        return;
+    }
+    rtw::thread_pool pool;
+    rtw::parallel_merge_sort(pool, first, last, compare);
+}
+
+template<typename RandomAccessIterator>
+void parallel_merge_sort(RandomAccessIterator first, RandomAccessIterator last)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    rtw::parallel_merge_sort(first, last, std::less<value_type>());
+}
+
+} // namespace rtw
+
+#endif // RTW_PARALLEL_MERGE_SORT_HPP
\ No newline at end of file
@@ -0,0 +1,81 @@
+#ifndef RTW_PARALLEL_SORT_HPP
+#define RTW_PARALLEL_SORT_HPP
+
+#include <functional>
+#include <iterator>
+
+#include <rtw/algorithm/heap.hpp>
+#include <rtw/algorithm/insertion_sort.hpp>
+#include <rtw/algorithm/intro_sort.hpp>
+#include <rtw/algorithm/quick_sort.hpp>
+#include <rtw/algorithm/sort_network.hpp>
+#include <rtw/thread/thread_pool.hpp>
+
+namespace rtw{
+
+// sub-ranges longer than this are handed to the pool, shorter ones are sorted serially by the task that owns them
+enum { parallel_sort_threshold = 1 << 14 };
+
+template<typename RandomAccessIterator, typename Size, typename Compare>
+void parallel_intro_sort_loop(rtw::task_group& group, RandomAccessIterator first, RandomAccessIterator last, Size depth, Compare compare)
+{
+    while(last - first > parallel_sort_threshold){
+        if(depth == 0){
+            rtw::make_heap(first, last, compare);
+            rtw::sort_heap(first, last, compare);
+            return;
+        }
+        --depth;
+        RandomAccessIterator cut = rtw::partition_pivot(first, last, compare);
+        group.run([&group, cut, last, depth, compare]() -> void {
+            rtw::parallel_intro_sort_loop(group, cut, last, depth, compare);
+        });
+        last = cut;
+    }
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    rtw::intro_sort_loop(first, last, depth, compare);
+    if constexpr(!rtw::use_sort_network<value_type, Compare>::value){
+        rtw::insertion_sort(first, last, compare);
+    }
+}
+
+template<typename RandomAccessIterator, typename Compare>
+void parallel_sort(rtw::thread_pool& pool, RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    if(last - first <= parallel_sort_threshold){
+        rtw::intro_sort(first, last, compare);
+        return;
+    }
+    rtw::task_group group(pool);
+    rtw::parallel_intro_sort_loop(group, first, last, rtw::intro_sort_depth_limit(last - first), compare);
+    group.wait();
+}
+
+template<typename RandomAccessIterator>
+void parallel_sort(rtw::thread_pool& pool, RandomAccessIterator first, RandomAccessIterator last)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    rtw::parallel_sort(pool, first, last, std::less<value_type>());
+}
+
+template<typename RandomAccessIterator, typename Compare>
+void parallel_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    if(last - first <= parallel_sort_threshold){
+        rtw::intro_sort(first, last, compare);
+        return;
+    }
+    rtw::thread_pool pool;
+    rtw::parallel_sort(pool, first, last, compare);
+}
+
+template<typename RandomAccessIterator>
+void parallel_sort(RandomAccessIterator first, RandomAccessIterator last)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    rtw::parallel_sort(first, last, std::less<value_type>());
+}
+
+} // namespace rtw
+
+#endif // RTW_PARALLEL_SORT_HPP
\ No newline at end of file
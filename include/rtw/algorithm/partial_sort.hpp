@@ -12,7 +12,7 @@ constexpr void partial_sort(RandomAccessIterator first, RandomAccessIterator mid
     for(RandomAccessIterator it = middle; it < last; ++it){
         if(compare(*it, *first)){
             std::iter_swap(it, first);
-            rtw::adjust_heap(first, first, middle, compare);
+            rtw::adjust_heap_bottom_up(first, first, middle, compare);
         }
     }
     rtw::sort_heap(first, middle, compare);
@@ -0,0 +1,262 @@
+#ifndef RTW_PDQ_SORT_HPP
+#define RTW_PDQ_SORT_HPP
+
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include <rtw/algorithm/heap.hpp>
+#include <rtw/algorithm/insertion_sort.hpp>
+#include <rtw/algorithm/quick_sort.hpp>
+
+namespace rtw{
+
+enum { pdq_insertion_sort_threshold = 24, pdq_ninther_threshold = 128, pdq_partial_insertion_sort_limit = 8 };
+
+template<typename T>
+inline int pdq_log2(T n)
+{
+    int log = 0;
+    while(n >>= 1){
+        ++log;
+    }
+    return log;
+}
+
+template<typename RandomAccessIterator, typename Compare>
+inline void sort2(RandomAccessIterator a, RandomAccessIterator b, Compare compare)
+{
+    if(compare(*b, *a)){
+        std::iter_swap(a, b);
+    }
+}
+
+template<typename RandomAccessIterator, typename Compare>
+inline void sort3(RandomAccessIterator a, RandomAccessIterator b, RandomAccessIterator c, Compare compare)
+{
+    rtw::sort2(a, b, compare);
+    rtw::sort2(b, c, compare);
+    rtw::sort2(a, b, compare);
+}
+
+// insertion sort that relies on *(first - 1) being not greater than any element of [first, last)
+template<typename RandomAccessIterator, typename Compare>
+void unguarded_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    if(first == last){
+        return;
+    }
+    for(RandomAccessIterator unsorted = first + 1; unsorted != last; ++unsorted){
+        RandomAccessIterator insert_position = unsorted;
+        RandomAccessIterator next = unsorted - 1;
+        if(compare(*insert_position, *next)){
+            value_type value = std::move(*insert_position);
+            do{
+                *insert_position = std::move(*next);
+                --insert_position;
+            } while(compare(value, *--next));
+            *insert_position = std::move(value);
+        }
+    }
+}
+
+// insertion sort that gives up and returns false once more than pdq_partial_insertion_sort_limit elements have been moved
+template<typename RandomAccessIterator, typename Compare>
+bool partial_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    if(first == last){
+        return true;
+    }
+    typename std::iterator_traits<RandomAccessIterator>::difference_type moved = 0;
+    for(RandomAccessIterator unsorted = first + 1; unsorted != last; ++unsorted){
+        RandomAccessIterator insert_position = unsorted;
+        RandomAccessIterator next = unsorted - 1;
+        if(compare(*insert_position, *next)){
+            value_type value = std::move(*insert_position);
+            do{
+                *insert_position = std::move(*next);
+                --insert_position;
+            } while(insert_position != first && compare(value, *--next));
+            *insert_position = std::move(value);
+            moved += unsorted - insert_position;
+        }
+        if(moved > pdq_partial_insertion_sort_limit){
+            return false;
+        }
+    }
+    return true;
+}
+
+// partitions around *first into [first, pivot) < pivot <= (pivot, last) and returns the pivot position,
+// together with whether the range was already partitioned
+template<typename RandomAccessIterator, typename Compare>
+std::pair<RandomAccessIterator, bool> partition_right(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    value_type pivot = std::move(*first);
+    RandomAccessIterator begin = first;
+
+    // the median of three guarantees an element not less than the pivot, the left scan is only guarded if nothing is before first
+    while(compare(*++first, pivot));
+    if(first - 1 == begin){
+        while(first < last && !compare(*--last, pivot));
+    }
+    else{
+        while(!compare(*--last, pivot));
+    }
+    bool already_partitioned = first >= last;
+    if constexpr(rtw::use_block_partition<value_type, Compare>::value){
+        if(!already_partitioned){
+            std::iter_swap(first, last);
+            first = rtw::block_partition_range<true>(first + 1, last, pivot, compare);
+        }
+    }
+    else{
+        while(first < last){
+            std::iter_swap(first, last);
+            while(compare(*++first, pivot));
+            while(!compare(*--last, pivot));
+        }
+    }
+
+    RandomAccessIterator pivot_position = first - 1;
+    *begin = std::move(*pivot_position);
+    *pivot_position = std::move(pivot);
+    return std::make_pair(pivot_position, already_partitioned);
+}
+
+// partitions around *first into [first, pivot] <= pivot < (pivot, last), used when the pivot equals
+// the element before the range so that the whole left side is equal to the pivot
+template<typename RandomAccessIterator, typename Compare>
+RandomAccessIterator partition_left(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    value_type pivot = std::move(*first);
+    RandomAccessIterator begin = first;
+    RandomAccessIterator end = last;
+
+    while(compare(pivot, *--last));
+    if(last + 1 == end){
+        while(first < last && !compare(pivot, *++first));
+    }
+    else{
+        while(!compare(pivot, *++first));
+    }
+    while(first < last){
+        std::iter_swap(first, last);
+        while(compare(pivot, *--last));
+        while(!compare(pivot, *++first));
+    }
+
+    RandomAccessIterator pivot_position = last;
+    *begin = std::move(*pivot_position);
+    *pivot_position = std::move(pivot);
+    return pivot_position;
+}
+
+template<typename RandomAccessIterator, typename Compare>
+void pdq_sort_loop(RandomAccessIterator first, RandomAccessIterator last, Compare compare, int bad_allowed, bool leftmost)
+{
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    while(true){
+        difference_type size = last - first;
+        if(size < pdq_insertion_sort_threshold){
+            if(leftmost){
+                rtw::insertion_sort(first, last, compare);
+            }
+            else{
+                rtw::unguarded_insertion_sort(first, last, compare);
+            }
+            return;
+        }
+
+        // median of three, or the pseudomedian of nine (ninther) for large ranges
+        difference_type half = size / 2;
+        if(size > pdq_ninther_threshold){
+            rtw::sort3(first, first + half, last - 1, compare);
+            rtw::sort3(first + 1, first + (half - 1), last - 2, compare);
+            rtw::sort3(first + 2, first + (half + 1), last - 3, compare);
+            rtw::sort3(first + (half - 1), first + half, first + (half + 1), compare);
+            std::iter_swap(first, first + half);
+        }
+        else{
+            rtw::sort3(first + half, first, last - 1, compare);
+        }
+
+        // *(first - 1) is not greater than any element of the range, so a pivot equal to it means
+        // every element equal to the pivot can be grouped on the left and never looked at again
+        if(!leftmost && !compare(*(first - 1), *first)){
+            first = rtw::partition_left(first, last, compare) + 1;
+            continue;
+        }
+
+        std::pair<RandomAccessIterator, bool> result = rtw::partition_right(first, last, compare);
+        RandomAccessIterator pivot_position = result.first;
+        bool already_partitioned = result.second;
+
+        difference_type left_size = pivot_position - first;
+        difference_type right_size = last - (pivot_position + 1);
+        if(left_size < size / 8 || right_size < size / 8){
+            // too many bad partitions, fall back to heapsort to guarantee O(n log n)
+            if(--bad_allowed == 0){
+                rtw::make_heap(first, last, compare);
+                rtw::sort_heap(first, last, compare);
+                return;
+            }
+
+            // shuffle some elements to break the pattern that made the partition unbalanced
+            if(left_size >= pdq_insertion_sort_threshold){
+                std::iter_swap(first, first + left_size / 4);
+                std::iter_swap(pivot_position - 1, pivot_position - left_size / 4);
+                if(left_size > pdq_ninther_threshold){
+                    std::iter_swap(first + 1, first + (left_size / 4 + 1));
+                    std::iter_swap(first + 2, first + (left_size / 4 + 2));
+                    std::iter_swap(pivot_position - 2, pivot_position - (left_size / 4 + 1));
+                    std::iter_swap(pivot_position - 3, pivot_position - (left_size / 4 + 2));
+                }
+            }
+            if(right_size >= pdq_insertion_sort_threshold){
+                std::iter_swap(pivot_position + 1, pivot_position + (1 + right_size / 4));
+                std::iter_swap(last - 1, last - right_size / 4);
+                if(right_size > pdq_ninther_threshold){
+                    std::iter_swap(pivot_position + 2, pivot_position + (2 + right_size / 4));
+                    std::iter_swap(pivot_position + 3, pivot_position + (3 + right_size / 4));
+                    std::iter_swap(last - 2, last - (1 + right_size / 4));
+                    std::iter_swap(last - 3, last - (2 + right_size / 4));
+                }
+            }
+        }
+        else if(already_partitioned
+            && rtw::partial_insertion_sort(first, pivot_position, compare)
+            && rtw::partial_insertion_sort(pivot_position + 1, last, compare)){
+            // a balanced partition that moved nothing, and both sides turned out to be (nearly) sorted
+            return;
+        }
+
+        rtw::pdq_sort_loop(first, pivot_position, compare, bad_allowed, leftmost);
+        first = pivot_position + 1;
+        leftmost = false;
+    }
+}
+
+template<typename RandomAccessIterator, typename Compare>
+void pdq_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    if(last - first < 2){
+        return;
+    }
+    rtw::pdq_sort_loop(first, last, compare, rtw::pdq_log2(last - first), true);
+}
+
+template<typename RandomAccessIterator>
+void pdq_sort(RandomAccessIterator first, RandomAccessIterator last)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    rtw::pdq_sort(first, last, std::less<value_type>());
+}
+
+} // namespace rtw
+
+#endif // RTW_PDQ_SORT_HPP
\ No newline at end of file
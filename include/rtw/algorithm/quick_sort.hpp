@@ -1,10 +1,22 @@
 #ifndef RTW_QUICK_SORT_HPP
 #define RTW_QUICK_SORT_HPP
 
+#include <cstddef>
+#include <functional>
 #include <iterator>
+#include <type_traits>
 
 namespace rtw {
 
+enum { block_partition_size = 64, block_partition_threshold = 128 };
+
+// block partitioning pays off when comparisons are cheap and free of side effects
+template<typename T, typename Compare>
+struct use_block_partition : std::integral_constant<bool,
+    std::is_arithmetic<T>::value && (
+        std::is_same<Compare, std::less<T>>::value || std::is_same<Compare, std::less<>>::value ||
+        std::is_same<Compare, std::greater<T>>::value || std::is_same<Compare, std::greater<>>::value)>{};
+
 template<typename Iterator, typename Compare>
 void move_median_to_first(Iterator result, Iterator a, Iterator b, Iterator c, Compare compare)
 {
@@ -51,11 +63,131 @@ constexpr RandomAccessIterator partition(RandomAccessIterator first, RandomAcces
     }
 }
 
+// moves the elements at left_base + offsets_l[i] and right_base - offsets_r[i] to the other side as one cycle
+template<typename RandomAccessIterator>
+inline void swap_offsets(RandomAccessIterator left_base, RandomAccessIterator right_base, const unsigned char* offsets_l, const unsigned char* offsets_r, std::size_t num)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    if(num == 0){
+        return;
+    }
+    RandomAccessIterator left = left_base + offsets_l[0];
+    RandomAccessIterator right = right_base - offsets_r[0];
+    value_type temp = std::move(*left);
+    *left = std::move(*right);
+    for(std::size_t i = 1; i < num; ++i){
+        left = left_base + offsets_l[i];
+        *right = std::move(*left);
+        right = right_base - offsets_r[i];
+        *left = std::move(*right);
+    }
+    *right = std::move(temp);
+}
+
+// partitions the unknown range [first, last) in blocks, recording misplaced elements as offsets and swapping them in batches (BlockQuicksort);
+// the left side moves elements that are not less than the pivot, the right side moves elements that are less than the pivot (Strict)
+// or not greater than it, and the returned boundary splits the two classes
+template<bool Strict, typename RandomAccessIterator, typename T, typename Compare>
+RandomAccessIterator block_partition_range(RandomAccessIterator first, RandomAccessIterator last, const T& pivot, Compare compare)
+{
+    alignas(64) unsigned char offsets_l[block_partition_size];
+    alignas(64) unsigned char offsets_r[block_partition_size];
+    RandomAccessIterator left_base = first;
+    RandomAccessIterator right_base = last;
+    std::size_t num_l = 0;
+    std::size_t num_r = 0;
+    std::size_t start_l = 0;
+    std::size_t start_r = 0;
+    while(first < last){
+        std::size_t num_unknown = last - first;
+        std::size_t left_split = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+        std::size_t right_split = num_r == 0 ? num_unknown - left_split : 0;
+        left_split = left_split < block_partition_size ? left_split : block_partition_size;
+        right_split = right_split < block_partition_size ? right_split : block_partition_size;
+
+        // the offsets are written unconditionally and kept by advancing the count, so there is no branch to mispredict
+        for(std::size_t i = 0; i < left_split; ++i){
+            offsets_l[num_l] = static_cast<unsigned char>(i);
+            num_l += !compare(*first, pivot);
+            ++first;
+        }
+        for(std::size_t i = 0; i < right_split; ){
+            offsets_r[num_r] = static_cast<unsigned char>(++i);
+            --last;
+            if constexpr(Strict){
+                num_r += compare(*last, pivot);
+            }
+            else{
+                num_r += !compare(pivot, *last);
+            }
+        }
+
+        std::size_t num = num_l < num_r ? num_l : num_r;
+        rtw::swap_offsets(left_base, right_base, offsets_l + start_l, offsets_r + start_r, num);
+        num_l -= num;
+        num_r -= num;
+        start_l += num;
+        start_r += num;
+        if(num_l == 0){
+            start_l = 0;
+            left_base = first;
+        }
+        if(num_r == 0){
+            start_r = 0;
+            right_base = last;
+        }
+    }
+
+    // at most one block still holds misplaced elements, move them next to the boundary
+    if(num_l){
+        while(num_l--){
+            std::iter_swap(left_base + offsets_l[start_l + num_l], --last);
+        }
+        first = last;
+    }
+    if(num_r){
+        while(num_r--){
+            std::iter_swap(right_base - offsets_r[start_r + num_r], first);
+            ++first;
+        }
+    }
+    return first;
+}
+
+// Hoare partition around *first using block_partition_range,
+// *first must be the median of three so that both scans are guarded
+template<typename RandomAccessIterator, typename Compare>
+RandomAccessIterator block_partition(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    const value_type pivot = *first;
+    RandomAccessIterator begin = first;
+
+    while(compare(*++first, pivot));
+    while(compare(pivot, *--last));
+    if(first < last){
+        std::iter_swap(first, last);
+        first = rtw::block_partition_range<false>(first + 1, last, pivot, compare);
+    }
+
+    // [begin, first) <= pivot <= [first, last of the range), put the pivot between them
+    RandomAccessIterator pivot_position = first - 1;
+    *begin = *pivot_position;
+    *pivot_position = pivot;
+    return pivot_position != begin ? pivot_position : pivot_position + 1;
+}
+
 template<typename RandomAccessIterator, typename Compare>
 constexpr RandomAccessIterator partition_pivot(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
 {
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
     RandomAccessIterator middle = first + (last - first) / 2;
     rtw::move_median_to_first(first, first, middle, last - 1, compare);
+    if constexpr(rtw::use_block_partition<value_type, Compare>::value){
+        if(last - first > block_partition_threshold){
+            return rtw::block_partition(first, last, compare);
+        }
+    }
     return rtw::partition(first, last, compare);
 }
 
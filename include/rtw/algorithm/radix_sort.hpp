@@ -0,0 +1,128 @@
+#ifndef RTW_RADIX_SORT_HPP
+#define RTW_RADIX_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+#include <rtw/algorithm/insertion_sort.hpp>
+#include <rtw/container/vector.hpp>
+
+namespace rtw{
+
+enum { radix_bits = 8, radix_size = 1 << radix_bits, radix_sort_threshold = 64 };
+
+// maps a key to an unsigned integer whose natural order is the order of the key
+template<typename T, typename = void>
+struct radix_traits;
+
+template<typename T>
+struct radix_traits<T, std::enable_if_t<std::is_integral<T>::value && std::is_unsigned<T>::value>>{
+    using key_type = T;
+    static constexpr key_type key(T value) noexcept{
+        return value;
+    }
+};
+
+template<typename T>
+struct radix_traits<T, std::enable_if_t<std::is_integral<T>::value && std::is_signed<T>::value>>{
+    using key_type = std::make_unsigned_t<T>;
+    static constexpr key_type key(T value) noexcept{
+        return static_cast<key_type>(static_cast<key_type>(value) ^ (key_type(1) << (8 * sizeof(T) - 1)));
+    }
+};
+
+// IEEE-754: negative values have every bit flipped, positive values only the sign bit, so NaNs are ordered by their bit pattern
+template<typename T>
+struct radix_traits<T, std::enable_if_t<std::is_floating_point<T>::value && (sizeof(T) == 4 || sizeof(T) == 8)>>{
+    using key_type = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+    static key_type key(T value) noexcept{
+        key_type bits;
+        std::memcpy(&bits, &value, sizeof(T));
+        const key_type sign = key_type(1) << (8 * sizeof(T) - 1);
+        return (bits & sign) ? ~bits : (bits | sign);
+    }
+};
+
+template<typename InputIterator, typename OutputIterator, typename Size>
+void radix_scatter(InputIterator first, InputIterator last, OutputIterator result, Size* offsets, std::size_t shift)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+    using traits = rtw::radix_traits<value_type>;
+    while(first != last){
+        std::size_t digit = (traits::key(*first) >> shift) & (radix_size - 1);
+        *(result + offsets[digit]) = std::move(*first);
+        ++offsets[digit];
+        ++first;
+    }
+}
+
+template<typename RandomAccessIterator, typename Pointer>
+void radix_sort(RandomAccessIterator first, RandomAccessIterator last, Pointer buffer)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    using traits = rtw::radix_traits<value_type>;
+    using key_type = typename traits::key_type;
+    constexpr std::size_t passes = sizeof(key_type);
+
+    difference_type n = last - first;
+    if(n <= radix_sort_threshold){
+        rtw::insertion_sort(first, last, [](const value_type& lhs, const value_type& rhs) -> bool {
+            return traits::key(lhs) < traits::key(rhs);
+        });
+        return;
+    }
+
+    // histograms of every digit in one pass
+    difference_type counts[passes][radix_size] = {};
+    for(RandomAccessIterator it = first; it != last; ++it){
+        key_type key = traits::key(*it);
+        for(std::size_t pass = 0; pass < passes; ++pass){
+            ++counts[pass][(key >> (pass * radix_bits)) & (radix_size - 1)];
+        }
+    }
+
+    bool in_buffer = false;
+    for(std::size_t pass = 0; pass < passes; ++pass){
+        difference_type* count = counts[pass];
+        std::size_t shift = pass * radix_bits;
+        key_type key = in_buffer ? traits::key(*buffer) : traits::key(*first);
+        if(count[(key >> shift) & (radix_size - 1)] == n){
+            continue;
+        }
+        difference_type offset = 0;
+        for(std::size_t digit = 0; digit < radix_size; ++digit){
+            difference_type size = count[digit];
+            count[digit] = offset;
+            offset += size;
+        }
+        if(in_buffer){
+            rtw::radix_scatter(buffer, buffer + n, first, count, shift);
+        }
+        else{
+            rtw::radix_scatter(first, last, buffer, count, shift);
+        }
+        in_buffer = !in_buffer;
+    }
+    if(in_buffer){
+        std::move(buffer, buffer + n, first);
+    }
+}
+
+template<typename RandomAccessIterator>
+void radix_sort(RandomAccessIterator first, RandomAccessIterator last)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    difference_type distance = std::distance(first, last);
+    rtw::vector<value_type> buffer(distance);
+    rtw::radix_sort(first, last, buffer.begin());
+}
+
+} // namespace rtw
+
+#endif // RTW_RADIX_SORT_HPP
\ No newline at end of file
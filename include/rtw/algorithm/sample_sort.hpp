@@ -0,0 +1,566 @@
+#ifndef RTW_SAMPLE_SORT_HPP
+#define RTW_SAMPLE_SORT_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include <rtw/algorithm/insertion_sort.hpp>
+#include <rtw/algorithm/intro_sort.hpp>
+#include <rtw/container/vector.hpp>
+#include <rtw/thread/thread_pool.hpp>
+
+namespace rtw{
+
+// in-place super-scalar samplesort after IPS4o (Axtmann, Witt, Ferizovic and Sanders, 2017).
+// Every level classifies the range into up to 256 buckets with a branchless search tree over sampled splitters,
+// gathers the elements into blocks of sample_sort_block_bytes in small per-bucket buffers, writes full blocks back
+// over the range and permutes them into their buckets, so that the extra memory is a few blocks per bucket and thread.
+enum { sample_sort_log_buckets = 8, sample_sort_block_bytes = 2048, sample_sort_base = 1 << 12, sample_sort_insertion = 16 };
+
+template<typename T>
+constexpr std::ptrdiff_t sample_sort_block()
+{
+    return sizeof(T) >= sample_sort_block_bytes ? 1 : sample_sort_block_bytes / sizeof(T);
+}
+
+// splitters laid out as an implicit binary tree, so that finding the bucket of an element is log2(k) comparisons
+// whose results only ever feed the next index, with no branch to mispredict.
+// With equal buckets every splitter also gets a bucket of its own for the elements equal to it, which are never sorted again.
+template<typename T, typename Compare>
+class sample_sort_classifier{
+private:
+    rtw::vector<T> tree_;
+    rtw::vector<T> sorted_;
+    std::size_t log_buckets_;
+    bool equal_buckets_;
+    Compare compare_;
+public:
+    // splitters is sorted and has no duplicates
+    sample_sort_classifier(const rtw::vector<T>& splitters, bool equal_buckets, Compare compare)
+    : tree_()
+    , sorted_()
+    , log_buckets_(1)
+    , equal_buckets_(equal_buckets)
+    , compare_(compare){
+        while((std::size_t(1) << log_buckets_) < splitters.size() + 1){
+            ++log_buckets_;
+        }
+        std::size_t k = std::size_t(1) << log_buckets_;
+        // pad with the last splitter; the buckets between the padding stay empty
+        sorted_.resize(k);
+        for(std::size_t i = 0; i < k; ++i){
+            sorted_[i] = splitters[std::min(i, splitters.size() - 1)];
+        }
+        // node 2^l + p of level l is the in-order element (2p + 1) * 2^(L - 1 - l) - 1
+        tree_.resize(k);
+        for(std::size_t level = 0; level < log_buckets_; ++level){
+            for(std::size_t p = 0; p < (std::size_t(1) << level); ++p){
+                tree_[(std::size_t(1) << level) + p] = sorted_[(2 * p + 1) * (std::size_t(1) << (log_buckets_ - 1 - level)) - 1];
+            }
+        }
+    }
+public:
+    std::size_t buckets() const noexcept{
+        return std::size_t(1) << (log_buckets_ + (equal_buckets_ ? 1 : 0));
+    }
+    bool equal_buckets() const noexcept{
+        return equal_buckets_;
+    }
+    // without equal buckets, bucket b holds (splitter[b - 1], splitter[b]]; with them, bucket 2b holds
+    // (splitter[b - 1], splitter[b]) and bucket 2b + 1 the elements equal to splitter[b]
+    template<bool EqualBuckets>
+    std::size_t classify(const T& value) const{
+        std::size_t k = std::size_t(1) << log_buckets_;
+        std::size_t i = 1;
+        for(std::size_t level = 0; level < log_buckets_; ++level){
+            i = 2 * i + static_cast<std::size_t>(compare_(tree_[i], value));
+        }
+        std::size_t bucket = i - k;
+        if constexpr(EqualBuckets){
+            return 2 * bucket + static_cast<std::size_t>((bucket != k - 1) & !compare_(value, sorted_[bucket]));
+        }
+        else{
+            return bucket;
+        }
+    }
+    // classifies eight elements together so that their searches overlap
+    template<bool EqualBuckets, typename RandomAccessIterator>
+    void classify_unrolled(RandomAccessIterator first, std::size_t* buckets) const{
+        enum { unroll = 8 };
+        std::size_t k = std::size_t(1) << log_buckets_;
+        std::size_t i[unroll];
+        for(int u = 0; u < unroll; ++u){
+            i[u] = 1;
+        }
+        for(std::size_t level = 0; level < log_buckets_; ++level){
+            for(int u = 0; u < unroll; ++u){
+                i[u] = 2 * i[u] + static_cast<std::size_t>(compare_(tree_[i[u]], first[u]));
+            }
+        }
+        for(int u = 0; u < unroll; ++u){
+            std::size_t bucket = i[u] - k;
+            if constexpr(EqualBuckets){
+                buckets[u] = 2 * bucket + static_cast<std::size_t>((bucket != k - 1) & !compare_(first[u], sorted_[bucket]));
+            }
+            else{
+                buckets[u] = bucket;
+            }
+        }
+    }
+};
+
+// what one thread needs on every level: a block buffer per bucket and two blocks to swap through
+template<typename T>
+struct sample_sort_local{
+    rtw::vector<T> buffer;
+    rtw::vector<std::ptrdiff_t> fill;
+    rtw::vector<std::ptrdiff_t> counts;
+    rtw::vector<T> swap;
+    std::ptrdiff_t stripe_begin;
+    std::ptrdiff_t stripe_end;
+    std::ptrdiff_t full_end;
+
+    void reset(std::size_t buckets){
+        std::ptrdiff_t block = rtw::sample_sort_block<T>();
+        if(buffer.size() < buckets * block){
+            buffer.resize(buckets * block);
+            swap.resize(2 * block);
+        }
+        fill.assign(buckets, 0);
+        counts.assign(buckets, 0);
+    }
+};
+
+// the state of one level shared by its threads
+template<typename T>
+struct sample_sort_level{
+    rtw::vector<std::ptrdiff_t> bounds;
+    rtw::vector<std::ptrdiff_t> write;
+    rtw::vector<std::ptrdiff_t> read;
+    std::unique_ptr<std::mutex[]> mutexes;
+    std::size_t mutex_count;
+    rtw::vector<T> overflow;
+    std::size_t overflow_bucket;
+
+    sample_sort_level()
+    : bounds()
+    , write()
+    , read()
+    , mutexes()
+    , mutex_count(0)
+    , overflow(rtw::sample_sort_block<T>())
+    , overflow_bucket(static_cast<std::size_t>(-1)){}
+
+    void reset(std::size_t buckets){
+        bounds.assign(buckets + 1, 0);
+        write.assign(buckets, 0);
+        read.assign(buckets, 0);
+        if(mutex_count < buckets){
+            mutexes.reset(new std::mutex[buckets]);
+            mutex_count = buckets;
+        }
+        overflow_bucket = static_cast<std::size_t>(-1);
+    }
+};
+
+inline std::ptrdiff_t sample_sort_round_up(std::ptrdiff_t position, std::ptrdiff_t block)
+{
+    return (position + block - 1) / block * block;
+}
+
+// draws a sample to the front of the range, sorts it and picks splitters from it;
+// duplicated splitters switch the level to equal buckets
+template<typename RandomAccessIterator, typename Compare>
+auto sample_sort_build(RandomAccessIterator first, std::ptrdiff_t size, Compare compare)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    std::ptrdiff_t block = rtw::sample_sort_block<value_type>();
+    std::size_t log_buckets = 1;
+    while(log_buckets < sample_sort_log_buckets && (std::ptrdiff_t(4) * block << (log_buckets + 1)) <= size){
+        ++log_buckets;
+    }
+    std::ptrdiff_t buckets = std::ptrdiff_t(1) << log_buckets;
+    std::ptrdiff_t oversampling = std::max<std::ptrdiff_t>(1, static_cast<std::ptrdiff_t>(0.2 * std::log2(static_cast<double>(size))));
+    std::ptrdiff_t sample = std::min(oversampling * buckets - 1, size / 2);
+    oversampling = std::max<std::ptrdiff_t>(1, (sample + 1) / buckets);
+
+    std::uint64_t state = static_cast<std::uint64_t>(size) * 0x9e3779b97f4a7c15ull + 1;
+    for(std::ptrdiff_t i = 0; i < sample; ++i){
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        std::ptrdiff_t j = i + static_cast<std::ptrdiff_t>(state % static_cast<std::uint64_t>(size - i));
+        std::iter_swap(first + i, first + j);
+    }
+    rtw::intro_sort(first, first + sample, compare);
+
+    rtw::vector<value_type> splitters;
+    splitters.reserve(buckets - 1);
+    bool equal_buckets = false;
+    for(std::ptrdiff_t i = 1; i < buckets; ++i){
+        const value_type& splitter = first[i * oversampling - 1];
+        if(!splitters.empty() && !compare(splitters.back(), splitter)){
+            equal_buckets = true;
+            continue;
+        }
+        splitters.push_back(splitter);
+    }
+    return rtw::sample_sort_classifier<value_type, Compare>(splitters, equal_buckets, compare);
+}
+
+// classifies the stripe [begin, end) into the buffers of local, writing every buffer that fills up back to the
+// front of the stripe: afterwards the stripe is full blocks up to full_end and the remaining elements are in the buffers
+template<bool EqualBuckets, typename RandomAccessIterator, typename Classifier, typename T>
+void sample_sort_classify(RandomAccessIterator first, std::ptrdiff_t begin, std::ptrdiff_t end, const Classifier& classifier, rtw::sample_sort_local<T>& local)
+{
+    std::ptrdiff_t block = rtw::sample_sort_block<T>();
+    std::ptrdiff_t write = begin;
+    auto push = [&](std::ptrdiff_t position, std::size_t bucket) -> void {
+        std::ptrdiff_t offset = bucket * block;
+        local.buffer[offset + local.fill[bucket]] = std::move(first[position]);
+        if(++local.fill[bucket] == block){
+            std::move(local.buffer.begin() + offset, local.buffer.begin() + offset + block, first + write);
+            write += block;
+            local.fill[bucket] = 0;
+            local.counts[bucket] += block;
+        }
+    };
+    std::ptrdiff_t i = begin;
+    for(; i + 8 <= end; i += 8){
+        std::size_t buckets[8];
+        classifier.template classify_unrolled<EqualBuckets>(first + i, buckets);
+        for(int u = 0; u < 8; ++u){
+            push(i + u, buckets[u]);
+        }
+    }
+    for(; i < end; ++i){
+        push(i, classifier.template classify<EqualBuckets>(first[i]));
+    }
+    for(std::size_t bucket = 0; bucket < local.fill.size(); ++bucket){
+        local.counts[bucket] += local.fill[bucket];
+    }
+    local.full_end = write;
+}
+
+// moves the full blocks of the bucket's block-aligned region to its front, the stripes having left empty blocks
+// between them; returns the number of full blocks
+template<typename RandomAccessIterator, typename T>
+std::ptrdiff_t sample_sort_gather(RandomAccessIterator first, std::ptrdiff_t region_begin, std::ptrdiff_t region_end, const rtw::vector<rtw::sample_sort_local<T>>& locals, bool move)
+{
+    std::ptrdiff_t block = rtw::sample_sort_block<T>();
+    std::ptrdiff_t full = 0;
+    for(const auto& local : locals){
+        std::ptrdiff_t begin = std::max(local.stripe_begin, region_begin);
+        std::ptrdiff_t end = std::min(local.full_end, region_end);
+        full += std::max<std::ptrdiff_t>(0, end - begin);
+    }
+    if(move){
+        std::ptrdiff_t stripe = locals[0].stripe_end - locals[0].stripe_begin;
+        auto is_full = [&locals, stripe](std::ptrdiff_t position) -> bool {
+            std::size_t index = static_cast<std::size_t>(position / stripe);
+            return index < locals.size() && position < locals[index].full_end;
+        };
+        std::ptrdiff_t middle = region_begin + full;
+        std::ptrdiff_t empty = region_begin;
+        std::ptrdiff_t last = region_end - block;
+        while(true){
+            while(empty < middle && is_full(empty)){
+                empty += block;
+            }
+            while(last >= middle && !is_full(last)){
+                last -= block;
+            }
+            if(empty >= middle || last < middle){
+                break;
+            }
+            std::move(first + last, first + last + block, first + empty);
+            empty += block;
+            last -= block;
+        }
+    }
+    return full / block;
+}
+
+// takes unplaced blocks from the back of the buckets' regions and swaps them to the front of the regions they belong to,
+// starting with the bucket of this thread; a block that would stick out of the range goes to the overflow buffer
+template<bool EqualBuckets, typename RandomAccessIterator, typename Classifier, typename T>
+void sample_sort_permute(RandomAccessIterator first, std::ptrdiff_t size, std::size_t primary, const Classifier& classifier, rtw::sample_sort_local<T>& local, rtw::sample_sort_level<T>& level)
+{
+    std::ptrdiff_t block = rtw::sample_sort_block<T>();
+    std::size_t buckets = level.write.size();
+    auto current = local.swap.begin();
+    auto other = local.swap.begin() + block;
+    for(std::size_t c = 0; c < buckets; ++c){
+        std::size_t source = (primary + c) % buckets;
+        while(true){
+            {
+                std::lock_guard<std::mutex> lock(level.mutexes[source]);
+                if(level.read[source] < level.write[source]){
+                    break;
+                }
+                std::move(first + level.read[source], first + level.read[source] + block, current);
+                level.read[source] -= block;
+            }
+            while(true){
+                std::size_t destination = classifier.template classify<EqualBuckets>(*current);
+                std::lock_guard<std::mutex> lock(level.mutexes[destination]);
+                std::ptrdiff_t& write = level.write[destination];
+                // blocks already in their bucket are stepped over
+                while(write <= level.read[destination] && classifier.template classify<EqualBuckets>(first[write]) == destination){
+                    write += block;
+                }
+                std::ptrdiff_t position = write;
+                write += block;
+                if(position <= level.read[destination]){
+                    std::move(first + position, first + position + block, other);
+                    std::move(current, current + block, first + position);
+                    std::swap(current, other);
+                    continue;
+                }
+                if(position + block > size){
+                    std::move(current, current + block, level.overflow.begin());
+                    level.overflow_bucket = destination;
+                }
+                else{
+                    std::move(current, current + block, first + position);
+                }
+                break;
+            }
+        }
+    }
+}
+
+// puts every bucket into [bounds[b], bounds[b + 1]): its blocks start at the block boundary after bounds[b], so the
+// head before it, the tail after its last block and anything past bounds[b + 1] have to be fixed up from the buffers
+template<typename RandomAccessIterator, typename T>
+void sample_sort_cleanup(RandomAccessIterator first, rtw::vector<rtw::sample_sort_local<T>>& locals, rtw::sample_sort_level<T>& level)
+{
+    std::ptrdiff_t block = rtw::sample_sort_block<T>();
+    std::size_t buckets = level.write.size();
+    for(std::size_t bucket = 0; bucket < buckets; ++bucket){
+        std::ptrdiff_t begin = level.bounds[bucket];
+        std::ptrdiff_t end = level.bounds[bucket + 1];
+        std::ptrdiff_t region = rtw::sample_sort_round_up(begin, block);
+        std::ptrdiff_t write = level.write[bucket];
+        bool overflow = bucket == level.overflow_bucket;
+        if(overflow){
+            write -= block;
+        }
+        std::ptrdiff_t head_end = std::min(region, end);
+        std::ptrdiff_t position = begin;
+        auto put = [&](T& value) -> void {
+            if(position == head_end){
+                position = std::max(write, head_end);
+            }
+            first[position++] = std::move(value);
+        };
+        for(std::ptrdiff_t i = std::max(end, region); i < write; ++i){
+            put(first[i]);
+        }
+        if(overflow){
+            for(std::ptrdiff_t i = 0; i < block; ++i){
+                put(level.overflow[i]);
+            }
+        }
+        for(auto& local : locals){
+            std::ptrdiff_t offset = bucket * block;
+            for(std::ptrdiff_t i = 0; i < local.fill[bucket]; ++i){
+                put(local.buffer[offset + i]);
+            }
+        }
+    }
+}
+
+// partitions [first, first + size) into the buckets of classifier, with one stripe per local; threads run the stripes
+// of a pool when given. Returns the bucket boundaries in level.bounds.
+template<bool EqualBuckets, typename RandomAccessIterator, typename Classifier, typename T>
+void sample_sort_partition(rtw::task_group* group, RandomAccessIterator first, std::ptrdiff_t size, const Classifier& classifier, rtw::vector<rtw::sample_sort_local<T>>& locals, rtw::sample_sort_level<T>& level)
+{
+    std::ptrdiff_t block = rtw::sample_sort_block<T>();
+    std::size_t threads = locals.size();
+    std::size_t buckets = classifier.buckets();
+    level.reset(buckets);
+    auto for_each_thread = [group, threads](auto&& function) -> void {
+        if(group == nullptr || threads == 1){
+            for(std::size_t t = 0; t < threads; ++t){
+                function(t);
+            }
+            return;
+        }
+        for(std::size_t t = 1; t < threads; ++t){
+            group->run([&function, t]() -> void { function(t); });
+        }
+        function(0);
+        group->wait();
+    };
+
+    std::ptrdiff_t stripe = rtw::sample_sort_round_up((size + threads - 1) / threads, block);
+    for_each_thread([&](std::size_t t) -> void {
+        rtw::sample_sort_local<T>& local = locals[t];
+        local.reset(buckets);
+        local.stripe_begin = std::min<std::ptrdiff_t>(t * stripe, size);
+        local.stripe_end = std::min<std::ptrdiff_t>(local.stripe_begin + stripe, size);
+        rtw::sample_sort_classify<EqualBuckets>(first, local.stripe_begin, local.stripe_end, classifier, local);
+    });
+
+    for(std::size_t bucket = 0; bucket < buckets; ++bucket){
+        std::ptrdiff_t count = 0;
+        for(const auto& local : locals){
+            count += local.counts[bucket];
+        }
+        level.bounds[bucket + 1] = level.bounds[bucket] + count;
+    }
+    for_each_thread([&](std::size_t t) -> void {
+        for(std::size_t bucket = t * buckets / threads; bucket < (t + 1) * buckets / threads; ++bucket){
+            std::ptrdiff_t region_begin = rtw::sample_sort_round_up(level.bounds[bucket], block);
+            std::ptrdiff_t region_end = rtw::sample_sort_round_up(level.bounds[bucket + 1], block);
+            std::ptrdiff_t full = rtw::sample_sort_gather(first, region_begin, region_end, locals, threads > 1);
+            level.write[bucket] = region_begin;
+            level.read[bucket] = region_begin + (full - 1) * block;
+        }
+    });
+
+    for_each_thread([&](std::size_t t) -> void {
+        rtw::sample_sort_permute<EqualBuckets>(first, size, t * buckets / threads, classifier, locals[t], level);
+    });
+    rtw::sample_sort_cleanup(first, locals, level);
+}
+
+// one level followed by the buckets, each of which is sorted again or, if small, by intro_sort or insertion_sort
+template<typename RandomAccessIterator, typename Compare, typename T>
+void sample_sort_loop(RandomAccessIterator first, std::ptrdiff_t size, Compare compare, rtw::vector<rtw::sample_sort_local<T>>& locals, rtw::sample_sort_level<T>& level, int depth)
+{
+    if(size <= sample_sort_insertion){
+        rtw::insertion_sort(first, first + size, compare);
+        return;
+    }
+    // an unlucky sample can keep everything in one bucket, so the depth is bounded as in intro_sort
+    if(size <= std::max<std::ptrdiff_t>(sample_sort_base, 16 * rtw::sample_sort_block<T>()) || depth == 0){
+        rtw::intro_sort(first, first + size, compare);
+        return;
+    }
+    auto classifier = rtw::sample_sort_build(first, size, compare);
+    bool equal_buckets = classifier.equal_buckets();
+    if(equal_buckets){
+        rtw::sample_sort_partition<true>(nullptr, first, size, classifier, locals, level);
+    }
+    else{
+        rtw::sample_sort_partition<false>(nullptr, first, size, classifier, locals, level);
+    }
+    rtw::vector<std::ptrdiff_t> bounds(level.bounds);
+    for(std::size_t bucket = 0; bucket + 1 < bounds.size(); ++bucket){
+        if(equal_buckets && bucket % 2 == 1){
+            continue;
+        }
+        rtw::sample_sort_loop(first + bounds[bucket], bounds[bucket + 1] - bounds[bucket], compare, locals, level, depth - 1);
+    }
+}
+
+template<typename RandomAccessIterator, typename Compare>
+void sample_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    std::ptrdiff_t size = last - first;
+    if(size <= sample_sort_base){
+        rtw::intro_sort(first, last, compare);
+        return;
+    }
+    rtw::vector<rtw::sample_sort_local<value_type>> locals(1);
+    rtw::sample_sort_level<value_type> level;
+    rtw::sample_sort_loop(first, size, compare, locals, level, static_cast<int>(std::log2(static_cast<double>(size))));
+}
+
+template<typename RandomAccessIterator>
+void sample_sort(RandomAccessIterator first, RandomAccessIterator last)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    rtw::sample_sort(first, last, std::less<value_type>());
+}
+
+// the top level is partitioned by every thread of the pool, each owning one stripe of the range,
+// then the threads take the buckets largest first and sort each of them alone
+template<typename RandomAccessIterator, typename Compare>
+void parallel_sample_sort(rtw::thread_pool& pool, RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    std::ptrdiff_t size = last - first;
+    std::size_t threads = std::min<std::size_t>(pool.size(), static_cast<std::size_t>(size / (sample_sort_base * 4)));
+    if(threads <= 1){
+        rtw::sample_sort(first, last, compare);
+        return;
+    }
+    rtw::task_group group(pool);
+    rtw::vector<rtw::sample_sort_local<value_type>> locals(threads);
+    rtw::sample_sort_level<value_type> level;
+    auto classifier = rtw::sample_sort_build(first, size, compare);
+    bool equal_buckets = classifier.equal_buckets();
+    if(equal_buckets){
+        rtw::sample_sort_partition<true>(&group, first, size, classifier, locals, level);
+    }
+    else{
+        rtw::sample_sort_partition<false>(&group, first, size, classifier, locals, level);
+    }
+
+    rtw::vector<std::size_t> order;
+    for(std::size_t bucket = 0; bucket + 1 < level.bounds.size(); ++bucket){
+        if(!(equal_buckets && bucket % 2 == 1) && level.bounds[bucket + 1] - level.bounds[bucket] > 1){
+            order.push_back(bucket);
+        }
+    }
+    rtw::intro_sort(order.begin(), order.end(), [&level](std::size_t lhs, std::size_t rhs) -> bool {
+        return level.bounds[lhs + 1] - level.bounds[lhs] > level.bounds[rhs + 1] - level.bounds[rhs];
+    });
+    std::atomic<std::size_t> next(0);
+    int depth = static_cast<int>(std::log2(static_cast<double>(size)));
+    auto work = [&, depth](std::size_t t) -> void {
+        rtw::vector<rtw::sample_sort_local<value_type>> local(1);
+        local[0] = std::move(locals[t]);
+        rtw::sample_sort_level<value_type> sublevel;
+        for(std::size_t i = next.fetch_add(1); i < order.size(); i = next.fetch_add(1)){
+            std::size_t bucket = order[i];
+            rtw::sample_sort_loop(first + level.bounds[bucket], level.bounds[bucket + 1] - level.bounds[bucket], compare, local, sublevel, depth - 1);
+        }
+    };
+    for(std::size_t t = 1; t < threads; ++t){
+        group.run([&work, t]() -> void { work(t); });
+    }
+    work(0);
+    group.wait();
+}
+
+template<typename RandomAccessIterator>
+void parallel_sample_sort(rtw::thread_pool& pool, RandomAccessIterator first, RandomAccessIterator last)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    rtw::parallel_sample_sort(pool, first, last, std::less<value_type>());
+}
+
+template<typename RandomAccessIterator, typename Compare>
+void parallel_sample_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    if(last - first <= sample_sort_base * 4){
+        rtw::sample_sort(first, last, compare);
+        return;
+    }
+    rtw::thread_pool pool;
+    rtw::parallel_sample_sort(pool, first, last, compare);
+}
+
+template<typename RandomAccessIterator>
+void parallel_sample_sort(RandomAccessIterator first, RandomAccessIterator last)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    rtw::parallel_sample_sort(first, last, std::less<value_type>());
+}
+
+} // namespace rtw
+
+#endif // RTW_SAMPLE_SORT_HPP
\ No newline at end of file
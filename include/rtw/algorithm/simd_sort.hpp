@@ -0,0 +1,177 @@
+#ifndef RTW_SIMD_SORT_HPP
+#define RTW_SIMD_SORT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <rtw/container/vector.hpp>
+#include <rtw/simd/avx2.hpp>
+#include <rtw/simd/avx512.hpp>
+#include <rtw/simd/isa.hpp>
+#include <rtw/simd/sse2.hpp>
+
+namespace rtw{
+
+// key types the vector kernels are written for
+template<typename T>
+struct is_simd_sortable : std::integral_constant<bool,
+    std::is_same<T, std::int32_t>::value || std::is_same<T, std::uint32_t>::value || std::is_same<T, std::int64_t>::value ||
+    std::is_same<T, float>::value || std::is_same<T, double>::value>{};
+
+// iterators over elements that are contiguous in memory
+template<typename Iterator>
+struct is_contiguous_iterator : std::false_type{};
+
+template<typename T>
+struct is_contiguous_iterator<T*> : std::true_type{};
+
+template<typename Allocator>
+struct is_contiguous_iterator<rtw::vector_iterator<Allocator>> : std::is_pointer<typename rtw::vector_iterator<Allocator>::pointer>{};
+
+template<typename T, typename Compare>
+struct is_less_compare : std::integral_constant<bool,
+    std::is_same<Compare, std::less<T>>::value || std::is_same<Compare, std::less<>>::value>{};
+
+template<typename T, typename Compare>
+struct is_greater_compare : std::integral_constant<bool,
+    std::is_same<Compare, std::greater<T>>::value || std::is_same<Compare, std::greater<>>::value>{};
+
+// the vector kernels sort ascending, a descending order is obtained by reversing the result
+template<typename RandomAccessIterator, typename Compare>
+struct use_simd_sort : std::integral_constant<bool,
+    rtw::is_contiguous_iterator<RandomAccessIterator>::value &&
+    rtw::is_simd_sortable<typename std::iterator_traits<RandomAccessIterator>::value_type>::value && (
+        rtw::is_less_compare<typename std::iterator_traits<RandomAccessIterator>::value_type, Compare>::value ||
+        rtw::is_greater_compare<typename std::iterator_traits<RandomAccessIterator>::value_type, Compare>::value)>{};
+
+// sorts [first, last) ascending with the kernel of the current simd_isa_level(); returns false and leaves
+// the range untouched when that level has no sort kernel. NaNs are not ordered, as with std::less.
+template<typename T>
+bool simd_sort(T* first, T* last)
+{
+    static_assert(rtw::is_simd_sortable<T>::value, "no vector kernel for this type");
+#if defined(RTW_SIMD_X86)
+    switch(rtw::simd_isa_level()){
+    case rtw::simd_isa::avx512:
+        rtw::avx512::sort(first, static_cast<std::size_t>(last - first));
+        return true;
+    case rtw::simd_isa::avx2:
+        rtw::avx2::sort(first, static_cast<std::size_t>(last - first));
+        return true;
+    default:
+        break;
+    }
+#else
+    static_cast<void>(first);
+    static_cast<void>(last);
+#endif
+    return false;
+}
+
+// nth_element counterpart of simd_sort
+template<typename T>
+bool simd_nth_element(T* first, T* nth, T* last)
+{
+    static_assert(rtw::is_simd_sortable<T>::value, "no vector kernel for this type");
+#if defined(RTW_SIMD_X86)
+    if(rtw::simd_isa_level() >= rtw::simd_isa::avx2 && nth == last){
+        return true;
+    }
+    switch(rtw::simd_isa_level()){
+    case rtw::simd_isa::avx512:
+        rtw::avx512::nth_element(first, static_cast<std::size_t>(last - first), static_cast<std::size_t>(nth - first));
+        return true;
+    case rtw::simd_isa::avx2:
+        rtw::avx2::nth_element(first, static_cast<std::size_t>(last - first), static_cast<std::size_t>(nth - first));
+        return true;
+    default:
+        break;
+    }
+#else
+    static_cast<void>(first);
+    static_cast<void>(nth);
+    static_cast<void>(last);
+#endif
+    return false;
+}
+
+// the first least (Max false) or greatest element of [first, last) by the reduction kernel of the current simd_isa_level()
+// into result; returns false when that level has no kernel for T or a NaN leaves the order undefined
+template<bool Max, typename T>
+bool simd_extremum_element(const T* first, const T* last, const T*& result)
+{
+    static_assert(rtw::is_simd_sortable<T>::value, "no vector kernel for this type");
+#if defined(RTW_SIMD_X86)
+    std::size_t size = static_cast<std::size_t>(last - first);
+    std::size_t index = size;
+    switch(rtw::simd_isa_level()){
+    case rtw::simd_isa::avx512:
+        index = Max ? rtw::avx512::max_element(first, size) : rtw::avx512::min_element(first, size);
+        break;
+    case rtw::simd_isa::avx2:
+        index = Max ? rtw::avx2::max_element(first, size) : rtw::avx2::min_element(first, size);
+        break;
+    case rtw::simd_isa::sse2:
+        if constexpr(rtw::sse2::has_vector_traits<T>::value){
+            index = Max ? rtw::sse2::max_element(first, size) : rtw::sse2::min_element(first, size);
+        }
+        break;
+    default:
+        break;
+    }
+    if(size > 0 && index < size){
+        result = first + index;
+        return true;
+    }
+#else
+    static_cast<void>(first);
+    static_cast<void>(last);
+    static_cast<void>(result);
+#endif
+    return false;
+}
+
+// minmax_element counterpart of simd_extremum_element, the first least and the first greatest element
+template<typename T>
+bool simd_minmax_element(const T* first, const T* last, const T*& min, const T*& max)
+{
+    static_assert(rtw::is_simd_sortable<T>::value, "no vector kernel for this type");
+#if defined(RTW_SIMD_X86)
+    std::size_t size = static_cast<std::size_t>(last - first);
+    std::pair<std::size_t, std::size_t> index(size, size);
+    switch(rtw::simd_isa_level()){
+    case rtw::simd_isa::avx512:
+        index = rtw::avx512::minmax_element(first, size);
+        break;
+    case rtw::simd_isa::avx2:
+        index = rtw::avx2::minmax_element(first, size);
+        break;
+    case rtw::simd_isa::sse2:
+        if constexpr(rtw::sse2::has_vector_traits<T>::value){
+            index = rtw::sse2::minmax_element(first, size);
+        }
+        break;
+    default:
+        break;
+    }
+    if(size > 0 && index.first < size){
+        min = first + index.first;
+        max = first + index.second;
+        return true;
+    }
+#else
+    static_cast<void>(first);
+    static_cast<void>(last);
+    static_cast<void>(min);
+    static_cast<void>(max);
+#endif
+    return false;
+}
+
+} // namespace rtw
+
+#endif // RTW_SIMD_SORT_HPP
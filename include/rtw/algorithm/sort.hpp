@@ -0,0 +1,253 @@
+#ifndef RTW_SORT_HPP
+#define RTW_SORT_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <rtw/algorithm/insertion_sort.hpp>
+#include <rtw/algorithm/intro_sort.hpp>
+#include <rtw/algorithm/pdq_sort.hpp>
+#include <rtw/algorithm/radix_sort.hpp>
+#include <rtw/algorithm/sample_sort.hpp>
+#include <rtw/algorithm/simd_sort.hpp>
+#include <rtw/algorithm/string_sort.hpp>
+#include <rtw/algorithm/tim_sort.hpp>
+#include <rtw/container/vector.hpp>
+
+namespace rtw{
+
+// ranges up to sort_insertion_threshold are insertion sorted without inspection; from sort_inspect_threshold on
+// only sort_sample_pairs adjacent pairs and sort_sample_values elements are looked at
+enum {
+    sort_insertion_threshold = 32,
+    sort_inspect_threshold = 512,
+    sort_sample_pairs = 256,
+    sort_sample_values = 256,
+    sort_radix_threshold = 1 << 12,
+    sort_large_threshold = 1 << 20
+};
+
+enum class sort_algorithm : int {
+    insertion_sort,
+    already_sorted,
+    reversed,
+    tim_sort,
+    string_sort,
+    simd_sort,
+    radix_sort,
+    pdq_sort,
+    sample_sort,
+    intro_sort
+};
+
+inline const char* sort_algorithm_name(sort_algorithm algorithm) noexcept
+{
+    switch(algorithm){
+    case sort_algorithm::insertion_sort: return "insertion_sort";
+    case sort_algorithm::already_sorted: return "already_sorted";
+    case sort_algorithm::reversed: return "reversed";
+    case sort_algorithm::tim_sort: return "tim_sort";
+    case sort_algorithm::string_sort: return "string_sort";
+    case sort_algorithm::simd_sort: return "simd_sort";
+    case sort_algorithm::radix_sort: return "radix_sort";
+    case sort_algorithm::pdq_sort: return "pdq_sort";
+    case sort_algorithm::sample_sort: return "sample_sort";
+    case sort_algorithm::intro_sort: return "intro_sort";
+    }
+    return "unknown";
+}
+
+// what rtw::sort saw and what it chose
+struct sort_statistics{
+    std::size_t size;
+    // adjacent pairs inspected, how many of them were in order and how many out of order
+    std::size_t pairs;
+    std::size_t ascents;
+    std::size_t descents;
+    // elements sampled and how many distinct values were among them
+    std::size_t values;
+    std::size_t distinct;
+    sort_algorithm algorithm;
+};
+
+using sort_statistics_hook = void (*)(const rtw::sort_statistics&);
+
+inline std::atomic<sort_statistics_hook>& sort_statistics_hook_state() noexcept
+{
+    static std::atomic<sort_statistics_hook> state(nullptr);
+    return state;
+}
+
+// installs a function that every rtw::sort call reports to, nullptr to stop reporting; returns the previous one
+inline sort_statistics_hook set_sort_statistics_hook(sort_statistics_hook hook) noexcept
+{
+    return rtw::sort_statistics_hook_state().exchange(hook, std::memory_order_acq_rel);
+}
+
+template<typename T>
+struct is_string_like : std::integral_constant<bool,
+    std::is_same<T, std::string>::value || std::is_same<T, std::string_view>::value>{};
+
+// adjacent pairs out of order, over every pair of a small range or over windows spread evenly over a large one
+template<typename RandomAccessIterator, typename Compare>
+void sort_inspect_order(RandomAccessIterator first, RandomAccessIterator last, Compare compare, rtw::sort_statistics& statistics)
+{
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    difference_type size = last - first;
+    auto count = [&](difference_type begin, difference_type end) -> void {
+        for(difference_type i = begin; i + 1 < end; ++i){
+            statistics.ascents += compare(first[i], first[i + 1]) ? 1 : 0;
+            statistics.descents += compare(first[i + 1], first[i]) ? 1 : 0;
+            ++statistics.pairs;
+        }
+    };
+    if(size <= sort_inspect_threshold){
+        count(0, size);
+        return;
+    }
+    enum { windows = 16, window = sort_sample_pairs / windows + 1 };
+    for(difference_type w = 0; w < windows; ++w){
+        difference_type begin = (size - window) * w / (windows - 1);
+        count(begin, begin + window);
+    }
+}
+
+// distinct values among elements spread evenly over the range
+template<typename RandomAccessIterator, typename Compare>
+void sort_inspect_values(RandomAccessIterator first, RandomAccessIterator last, Compare compare, rtw::sort_statistics& statistics)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    difference_type size = last - first;
+    rtw::vector<value_type> sample(sort_sample_values);
+    for(difference_type i = 0; i < sort_sample_values; ++i){
+        sample[i] = first[size * i / sort_sample_values];
+    }
+    rtw::intro_sort(sample.begin(), sample.end(), compare);
+    statistics.values = sort_sample_values;
+    statistics.distinct = 1;
+    for(difference_type i = 1; i < sort_sample_values; ++i){
+        statistics.distinct += compare(sample[i - 1], sample[i]) ? 1 : 0;
+    }
+}
+
+template<typename RandomAccessIterator, typename Compare>
+rtw::sort_algorithm sort_choose(RandomAccessIterator first, RandomAccessIterator last, Compare compare, rtw::sort_statistics& statistics)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    std::size_t size = static_cast<std::size_t>(last - first);
+    if(size <= sort_insertion_threshold){
+        return rtw::sort_algorithm::insertion_sort;
+    }
+
+    // presorted inputs: confirmed in full before nothing or a reversal is done, mostly ordered ones go to the run-adaptive merge
+    rtw::sort_inspect_order(first, last, compare, statistics);
+    if(statistics.descents == 0){
+        if(std::is_sorted(first, last, compare)){
+            return rtw::sort_algorithm::already_sorted;
+        }
+        return rtw::sort_algorithm::tim_sort;
+    }
+    if(statistics.ascents == 0){
+        if(std::adjacent_find(first, last, compare) == last){
+            return rtw::sort_algorithm::reversed;
+        }
+        return rtw::sort_algorithm::tim_sort;
+    }
+    if(statistics.descents * 32 <= statistics.pairs || statistics.ascents * 32 <= statistics.pairs){
+        return rtw::sort_algorithm::tim_sort;
+    }
+
+    // unordered inputs by value type
+    if constexpr(rtw::is_string_like<value_type>::value && rtw::is_less_compare<value_type, Compare>::value){
+        if(size >= sort_inspect_threshold){
+            return rtw::sort_algorithm::string_sort;
+        }
+    }
+    if constexpr(rtw::use_simd_sort<RandomAccessIterator, Compare>::value){
+        if(rtw::simd_isa_level() >= rtw::simd_isa::avx2){
+            return rtw::sort_algorithm::simd_sort;
+        }
+    }
+    if constexpr(std::is_integral<value_type>::value && !std::is_same<value_type, bool>::value && rtw::is_less_compare<value_type, Compare>::value){
+        if(size >= sort_radix_threshold){
+            return rtw::sort_algorithm::radix_sort;
+        }
+    }
+    if(size < sort_inspect_threshold){
+        return rtw::sort_algorithm::intro_sort;
+    }
+    // few distinct values: pattern-defeating quicksort groups the elements equal to the pivot and never sorts them again
+    rtw::sort_inspect_values(first, last, compare, statistics);
+    if(statistics.distinct * 8 <= statistics.values){
+        return rtw::sort_algorithm::pdq_sort;
+    }
+    if(size >= sort_large_threshold){
+        return rtw::sort_algorithm::sample_sort;
+    }
+    return rtw::sort_algorithm::intro_sort;
+}
+
+// sorts [first, last), not stably, with whichever algorithm of the library suits the input: a few adjacent pairs and
+// a small sample are inspected for presortedness and duplicates, and the value type and comparison pick the specialized
+// sorts. The choice is reported to the hook installed by set_sort_statistics_hook.
+template<typename RandomAccessIterator, typename Compare>
+void sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    rtw::sort_statistics statistics = { static_cast<std::size_t>(last - first), 0, 0, 0, 0, 0, rtw::sort_algorithm::intro_sort };
+    statistics.algorithm = rtw::sort_choose(first, last, compare, statistics);
+    if(rtw::sort_statistics_hook hook = rtw::sort_statistics_hook_state().load(std::memory_order_acquire)){
+        hook(statistics);
+    }
+
+    switch(statistics.algorithm){
+    case rtw::sort_algorithm::insertion_sort:
+        rtw::insertion_sort(first, last, compare);
+        break;
+    case rtw::sort_algorithm::already_sorted:
+        break;
+    case rtw::sort_algorithm::reversed:
+        std::reverse(first, last);
+        break;
+    case rtw::sort_algorithm::tim_sort:
+        rtw::tim_sort(first, last, compare);
+        break;
+    case rtw::sort_algorithm::string_sort:
+        if constexpr(rtw::is_string_like<typename std::iterator_traits<RandomAccessIterator>::value_type>::value){
+            rtw::string_sort(first, last);
+        }
+        break;
+    case rtw::sort_algorithm::radix_sort:
+        if constexpr(std::is_integral<typename std::iterator_traits<RandomAccessIterator>::value_type>::value){
+            rtw::radix_sort(first, last);
+        }
+        break;
+    case rtw::sort_algorithm::pdq_sort:
+        rtw::pdq_sort(first, last, compare);
+        break;
+    case rtw::sort_algorithm::sample_sort:
+        rtw::sample_sort(first, last, compare);
+        break;
+    case rtw::sort_algorithm::simd_sort:
+    case rtw::sort_algorithm::intro_sort:
+        rtw::intro_sort(first, last, compare);
+        break;
+    }
+}
+
+template<typename RandomAccessIterator>
+void sort(RandomAccessIterator first, RandomAccessIterator last)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    rtw::sort(first, last, std::less<value_type>());
+}
+
+} // namespace rtw
+
+#endif // RTW_SORT_HPP
\ No newline at end of file
@@ -0,0 +1,140 @@
+#ifndef RTW_SORT_NETWORK_HPP
+#define RTW_SORT_NETWORK_HPP
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <rtw/algorithm/quick_sort.hpp>
+
+namespace rtw{
+
+// largest range that sort_network_sort accepts
+enum { sort_network_max = 32 };
+
+// a network does more comparisons than insertion sort, it only wins when they are cheap and branchless
+template<typename T, typename Compare>
+struct use_sort_network : rtw::use_block_partition<T, Compare>{};
+
+// puts the smaller of a and b into a, arithmetic values are selected without branches
+template<typename T, typename Compare>
+inline void compare_exchange(T& a, T& b, Compare& compare)
+{
+    if constexpr(std::is_arithmetic<T>::value){
+        T x = a;
+        T y = b;
+        bool greater = compare(y, x);
+        a = greater ? y : x;
+        b = greater ? x : y;
+    }
+    else{
+        if(compare(b, a)){
+            std::swap(a, b);
+        }
+    }
+}
+
+// Batcher's odd-even merge sort generalized to any size, comparators that reach past n are dropped;
+// calls emit(i, j) for every comparator in order and returns how many there are
+template<typename Emit>
+constexpr std::size_t batcher_network(std::size_t n, Emit emit)
+{
+    std::size_t count = 0;
+    for(std::size_t p = 1; p < n; p *= 2){
+        for(std::size_t k = p; k >= 1; k /= 2){
+            for(std::size_t j = k % p; j + k < n; j += 2 * k){
+                for(std::size_t i = 0; i < k && i + j + k < n; ++i){
+                    if((i + j) / (2 * p) == (i + j + k) / (2 * p)){
+                        emit(i + j, i + j + k);
+                        ++count;
+                    }
+                }
+            }
+        }
+    }
+    return count;
+}
+
+struct batcher_ignore{
+    constexpr void operator()(std::size_t, std::size_t) const noexcept {}
+};
+
+template<std::size_t N, std::size_t Count>
+struct batcher_table{
+    std::array<unsigned char, Count> first{};
+    std::array<unsigned char, Count> second{};
+};
+
+template<std::size_t N, std::size_t Count>
+constexpr batcher_table<N, Count> make_batcher_table()
+{
+    batcher_table<N, Count> table{};
+    std::size_t index = 0;
+    rtw::batcher_network(N, [&table, &index](std::size_t i, std::size_t j) -> void {
+        table.first[index] = static_cast<unsigned char>(i);
+        table.second[index] = static_cast<unsigned char>(j);
+        ++index;
+    });
+    return table;
+}
+
+// sorts exactly N elements with a fixed sequence of compare-exchanges generated at compile time
+template<std::size_t N>
+struct sort_network{
+    static_assert(N <= sort_network_max, "sort_network supports up to sort_network_max elements");
+
+    static constexpr std::size_t size = N;
+    static constexpr std::size_t comparators = rtw::batcher_network(N, rtw::batcher_ignore());
+    static constexpr batcher_table<N, comparators> table = rtw::make_batcher_table<N, comparators>();
+
+    template<typename RandomAccessIterator, typename Compare>
+    static void sort(RandomAccessIterator first, Compare compare)
+    {
+        sort_network::apply(first, compare, std::make_index_sequence<comparators>());
+    }
+
+    template<typename RandomAccessIterator>
+    static void sort(RandomAccessIterator first)
+    {
+        using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+        sort_network::sort(first, std::less<value_type>());
+    }
+
+private:
+    template<typename RandomAccessIterator, typename Compare, std::size_t... I>
+    static void apply(RandomAccessIterator first, Compare& compare, std::index_sequence<I...>)
+    {
+        (rtw::compare_exchange(first[table.first[I]], first[table.second[I]], compare), ...);
+        static_cast<void>(first);
+        static_cast<void>(compare);
+    }
+};
+
+template<typename RandomAccessIterator, typename Compare, std::size_t... N>
+void sort_network_dispatch(RandomAccessIterator first, std::size_t size, Compare compare, std::index_sequence<N...>)
+{
+    using function = void (*)(RandomAccessIterator, Compare);
+    static constexpr function table[] = { &rtw::sort_network<N>::template sort<RandomAccessIterator, Compare>... };
+    table[size](first, compare);
+}
+
+// sorts a range of at most sort_network_max elements with the network of its size, not stable
+template<typename RandomAccessIterator, typename Compare>
+void sort_network_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    rtw::sort_network_dispatch(first, static_cast<std::size_t>(last - first), compare, std::make_index_sequence<sort_network_max + 1>());
+}
+
+template<typename RandomAccessIterator>
+void sort_network_sort(RandomAccessIterator first, RandomAccessIterator last)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    rtw::sort_network_sort(first, last, std::less<value_type>());
+}
+
+} // namespace rtw
+
+#endif // RTW_SORT_NETWORK_HPP
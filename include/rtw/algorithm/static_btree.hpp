@@ -0,0 +1,220 @@
+#ifndef RTW_STATIC_BTREE_HPP
+#define RTW_STATIC_BTREE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <rtw/algorithm/simd_sort.hpp>
+#include <rtw/container/vector.hpp>
+#include <rtw/simd/isa.hpp>
+
+namespace rtw{
+
+// read-only search index over a sorted range laid out as an implicit B+ tree of B keys per node (S+ tree): the leaves
+// are the sorted keys themselves, cut into nodes and padded with copies of the last key, and every internal node holds
+// for each of its B + 1 children but the first the least key below that child. Children are found by arithmetic,
+// node k of a layer having nodes k (B + 1), ..., k (B + 1) + B below it, so there are no pointers, and the layers are
+// stored root first in cache-line aligned nodes. A search reads one node per level, log_(B+1) n of them against the
+// log2 n scattered reads of a binary search; with 16 keys of 32 bits a node is one cache line and, for the arithmetic
+// types under std::less, is compared with the value in one or a few vector instructions whose mask is counted.
+// Searches return ranks in the sorted range, like rtw::lower_bound and rtw::upper_bound on it.
+template<typename T, std::size_t B = 16, typename Compare = std::less<T>>
+class static_btree{
+    static_assert(B >= 1, "a node needs at least one key");
+public:
+    using value_type = T;
+    using value_compare = Compare;
+    using size_type = std::size_t;
+    using const_reference = const T&;
+    static constexpr std::size_t node_size = B;
+    struct alignas(64) node{
+        T keys[B];
+    };
+private:
+    rtw::vector<node> nodes_;
+    // the first node of each layer and its number of nodes, root first
+    rtw::vector<size_type> offsets_;
+    rtw::vector<size_type> counts_;
+    size_type size_;
+    Compare comp_;
+public:
+    // constructor
+    explicit static_btree(const Compare& compare = Compare())
+    : nodes_()
+    , offsets_()
+    , counts_()
+    , size_(0)
+    , comp_(compare){}
+
+    // [first, last) sorted by compare; O(n)
+    template<typename RandomAccessIterator>
+    static_btree(RandomAccessIterator first, RandomAccessIterator last, const Compare& compare = Compare())
+    : nodes_()
+    , offsets_()
+    , counts_()
+    , size_(static_cast<size_type>(last - first))
+    , comp_(compare){
+        build(first);
+    }
+
+    explicit static_btree(const rtw::vector<T>& sorted, const Compare& compare = Compare())
+    : static_btree(sorted.begin(), sorted.end(), compare){}
+
+    static_btree(const static_btree& other) = default;
+    static_btree(static_btree&& other) = default;
+
+    // operator=
+    static_btree& operator=(const static_btree& other) = default;
+    static_btree& operator=(static_btree&& other) = default;
+
+    // destructor
+    ~static_btree() = default;
+public:
+    // capacity
+    bool empty() const noexcept{
+        return size_ == 0;
+    }
+    size_type size() const noexcept{
+        return size_;
+    }
+    // the number of levels a search reads
+    size_type height() const noexcept{
+        return counts_.size();
+    }
+
+    // element access
+    // the key of rank rank < size() in the sorted range, from the leaves
+    const_reference operator[](size_type rank) const{
+        return nodes_[offsets_.back() + rank / B].keys[rank % B];
+    }
+
+    // lookup
+    // the rank of the first key not less than value, size() if there is none
+    size_type lower_bound(const value_type& value) const{
+        return search<false>(value);
+    }
+    // the rank of the first key greater than value, size() if there is none
+    size_type upper_bound(const value_type& value) const{
+        return search<true>(value);
+    }
+    std::pair<size_type, size_type> equal_range(const value_type& value) const{
+        return std::make_pair(lower_bound(value), upper_bound(value));
+    }
+    bool contains(const value_type& value) const{
+        size_type rank = lower_bound(value);
+        return rank != size_ && !comp_(value, (*this)[rank]);
+    }
+
+    void swap(static_btree& other) noexcept(std::is_nothrow_swappable_v<Compare>){
+        using std::swap;
+        swap(nodes_, other.nodes_);
+        swap(offsets_, other.offsets_);
+        swap(counts_, other.counts_);
+        swap(size_, other.size_);
+        swap(comp_, other.comp_);
+    }
+private:
+    template<typename RandomAccessIterator>
+    void build(RandomAccessIterator first){
+        if(size_ == 0){
+            return;
+        }
+        // layer sizes from the leaves up, then turned root first
+        counts_.push_back((size_ + B - 1) / B);
+        while(counts_.back() > 1){
+            counts_.push_back((counts_.back() + B) / (B + 1));
+        }
+        std::reverse(counts_.begin(), counts_.end());
+        size_type total = 0;
+        for(size_type count : counts_){
+            offsets_.push_back(total);
+            total += count;
+        }
+        nodes_.resize(total);
+
+        // the keys of layer h are the least keys of the subtrees below, whose leaves span span keys each; converted by
+        // value, since the range may hold another type than T
+        auto key = [&](size_type index) -> T {
+            return static_cast<T>(first[static_cast<std::ptrdiff_t>(index < size_ ? index : size_ - 1)]);
+        };
+        size_type span = B;
+        for(size_type h = counts_.size(); h-- > 0;){
+            node* layer = &nodes_[offsets_[h]];
+            bool leaf = h + 1 == counts_.size();
+            for(size_type k = 0; k < counts_[h]; ++k){
+                for(size_type j = 0; j < B; ++j){
+                    layer[k].keys[j] = leaf ? key(k * B + j) : key((k * (B + 1) + j + 1) * span);
+                }
+            }
+            if(!leaf){
+                span *= B + 1;
+            }
+        }
+    }
+    template<bool Upper>
+    size_type search(const value_type& value) const{
+        if(size_ == 0){
+            return 0;
+        }
+        size_type rank;
+#if defined(RTW_SIMD_X86)
+        if constexpr(rtw::is_simd_sortable<T>::value && rtw::is_less_compare<T, Compare>::value){
+            switch(rtw::simd_isa_level()){
+            case rtw::simd_isa::avx512:
+                if constexpr(B % rtw::avx512::vector_traits<T>::lanes == 0){
+                    rank = rtw::avx512::btree_search<Upper, B>(nodes_.data(), offsets_.data(), counts_.data(), counts_.size(), value);
+                    return std::min(rank, size_);
+                }
+                break;
+            case rtw::simd_isa::avx2:
+                if constexpr(B % rtw::avx2::vector_traits<T>::lanes == 0){
+                    rank = rtw::avx2::btree_search<Upper, B>(nodes_.data(), offsets_.data(), counts_.data(), counts_.size(), value);
+                    return std::min(rank, size_);
+                }
+                break;
+            case rtw::simd_isa::sse2:
+                if constexpr(rtw::sse2::has_vector_traits<T>::value){
+                    if constexpr(B % rtw::sse2::vector_traits<T>::lanes == 0){
+                        rank = rtw::sse2::btree_search<Upper, B>(nodes_.data(), offsets_.data(), counts_.data(), counts_.size(), value);
+                        return std::min(rank, size_);
+                    }
+                }
+                break;
+            default:
+                break;
+            }
+        }
+#endif
+        // the same walk as the kernels, counting with the comparison; padding beyond the last key only ever adds to ranks
+        // that are size() already
+        size_type k = 0;
+        size_type height = counts_.size();
+        for(size_type h = 0; h + 1 < height; ++h){
+            size_type child = k * (B + 1) + node_rank<Upper>(nodes_[offsets_[h] + k].keys, value);
+            k = child < counts_[h + 1] ? child : counts_[h + 1] - 1;
+        }
+        rank = k * B + node_rank<Upper>(nodes_[offsets_[height - 1] + k].keys, value);
+        return std::min(rank, size_);
+    }
+    template<bool Upper>
+    size_type node_rank(const T* keys, const value_type& value) const{
+        size_type count = 0;
+        for(size_type j = 0; j < B; ++j){
+            count += (Upper ? !comp_(value, keys[j]) : comp_(keys[j], value)) ? 1 : 0;
+        }
+        return count;
+    }
+};
+
+template<typename T, std::size_t B, typename Compare>
+void swap(rtw::static_btree<T, B, Compare>& lhs, rtw::static_btree<T, B, Compare>& rhs) noexcept(noexcept(lhs.swap(rhs))){
+    lhs.swap(rhs);
+}
+
+} // namespace rtw
+
+#endif // RTW_STATIC_BTREE_HPP
\ No newline at end of file
@@ -0,0 +1,219 @@
+#ifndef RTW_STRING_SORT_HPP
+#define RTW_STRING_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+#include <utility>
+
+#include <rtw/algorithm/argsort.hpp>
+#include <rtw/algorithm/intro_sort.hpp>
+#include <rtw/container/vector.hpp>
+
+namespace rtw{
+
+// groups of at least string_sort_radix_threshold keys are split by one byte with a counting pass,
+// smaller ones by multikey quicksort on the next eight bytes, and tiny ones by insertion sort
+enum { string_sort_radix_threshold = 1 << 12, string_sort_insertion_threshold = 16, string_sort_cache_bytes = 8 };
+
+// a key being sorted: its bytes, its position in the input and the eight bytes from the current depth on,
+// big endian and zero padded so that comparing caches compares those bytes
+struct string_sort_entry{
+    const unsigned char* data;
+    std::size_t size;
+    std::uint64_t cache;
+    std::size_t index;
+};
+
+inline std::uint64_t string_sort_load(const string_sort_entry& entry, std::size_t depth)
+{
+    if(depth >= entry.size){
+        return 0;
+    }
+    const unsigned char* p = entry.data + depth;
+    std::size_t remaining = entry.size - depth;
+    std::uint64_t cache = 0;
+    if(remaining >= string_sort_cache_bytes){
+#if defined(__GNUC__)
+        std::memcpy(&cache, p, string_sort_cache_bytes);
+        return __builtin_bswap64(cache);
+#else
+        remaining = string_sort_cache_bytes;
+#endif
+    }
+    for(std::size_t i = 0; i < string_sort_cache_bytes; ++i){
+        cache = (cache << 8) | (i < remaining ? p[i] : 0u);
+    }
+    return cache;
+}
+
+// compares the keys from depth on, the bytes before depth being known to be equal
+inline bool string_sort_less(const string_sort_entry& lhs, const string_sort_entry& rhs, std::size_t depth)
+{
+    if(lhs.cache != rhs.cache){
+        return lhs.cache < rhs.cache;
+    }
+    std::size_t lhs_size = lhs.size > depth ? lhs.size - depth : 0;
+    std::size_t rhs_size = rhs.size > depth ? rhs.size - depth : 0;
+    std::size_t size = std::min(lhs_size, rhs_size);
+    int result = size == 0 ? 0 : std::memcmp(lhs.data + depth, rhs.data + depth, size);
+    return result != 0 ? result < 0 : lhs_size < rhs_size;
+}
+
+inline void string_sort_insertion(string_sort_entry* entries, std::size_t size, std::size_t depth)
+{
+    for(std::size_t i = 1; i < size; ++i){
+        string_sort_entry value = entries[i];
+        std::size_t j = i;
+        while(j > 0 && rtw::string_sort_less(value, entries[j - 1], depth)){
+            entries[j] = entries[j - 1];
+            --j;
+        }
+        entries[j] = value;
+    }
+}
+
+inline void string_sort_loop(string_sort_entry* entries, std::size_t size, std::size_t depth, string_sort_entry* buffer, int bad_allowed);
+
+// MSD radix step on the byte at depth, bucket 0 holding the keys that end before it; returns false without
+// touching anything when every key has the same byte, which multikey quicksort skips eight bytes at a time
+inline bool string_sort_radix(string_sort_entry* entries, std::size_t size, std::size_t depth, string_sort_entry* buffer, int bad_allowed)
+{
+    std::size_t counts[257] = {};
+    for(std::size_t i = 0; i < size; ++i){
+        ++counts[entries[i].size > depth ? (entries[i].cache >> 56) + 1 : 0];
+    }
+    if(*std::max_element(counts, counts + 257) == size){
+        return false;
+    }
+    std::size_t offsets[257];
+    std::size_t offset = 0;
+    for(std::size_t bucket = 0; bucket < 257; ++bucket){
+        offsets[bucket] = offset;
+        offset += counts[bucket];
+    }
+    for(std::size_t i = 0; i < size; ++i){
+        string_sort_entry entry = entries[i];
+        std::size_t bucket = entry.size > depth ? (entry.cache >> 56) + 1 : 0;
+        // shift the cache by the byte just used and pull in the next one
+        std::size_t next = depth + string_sort_cache_bytes;
+        entry.cache = (entry.cache << 8) | (next < entry.size ? entry.data[next] : 0u);
+        buffer[offsets[bucket]++] = entry;
+    }
+    std::copy(buffer, buffer + size, entries);
+
+    // the keys in bucket 0 are all equal
+    std::size_t begin = counts[0];
+    for(std::size_t bucket = 1; bucket < 257; ++bucket){
+        if(counts[bucket] > 1){
+            rtw::string_sort_loop(entries + begin, counts[bucket], depth + 1, buffer, bad_allowed);
+        }
+        begin += counts[bucket];
+    }
+    return true;
+}
+
+// multikey quicksort on the cached eight bytes: keys less than or greater than the pivot stay at this depth,
+// keys equal to it are either finished or continue eight bytes deeper
+inline void string_sort_loop(string_sort_entry* entries, std::size_t size, std::size_t depth, string_sort_entry* buffer, int bad_allowed)
+{
+    while(size > string_sort_insertion_threshold){
+        if(size >= string_sort_radix_threshold && rtw::string_sort_radix(entries, size, depth, buffer, bad_allowed)){
+            return;
+        }
+        if(bad_allowed == 0){
+            rtw::intro_sort(entries, entries + size, [depth](const string_sort_entry& lhs, const string_sort_entry& rhs) -> bool {
+                return rtw::string_sort_less(lhs, rhs, depth);
+            });
+            return;
+        }
+        --bad_allowed;
+
+        std::uint64_t a = entries[0].cache;
+        std::uint64_t b = entries[size / 2].cache;
+        std::uint64_t c = entries[size - 1].cache;
+        std::uint64_t pivot = std::max(std::min(a, b), std::min(std::max(a, b), c));
+        std::size_t less = 0;
+        std::size_t i = 0;
+        std::size_t greater = size;
+        while(i < greater){
+            if(entries[i].cache < pivot){
+                std::swap(entries[less++], entries[i++]);
+            }
+            else if(pivot < entries[i].cache){
+                std::swap(entries[i], entries[--greater]);
+            }
+            else{
+                ++i;
+            }
+        }
+
+        // equal caches: keys ending within these bytes come first, ordered by their length
+        string_sort_entry* equal = entries + less;
+        std::size_t equal_size = greater - less;
+        string_sort_entry* unfinished = std::partition(equal, equal + equal_size, [depth](const string_sort_entry& entry) -> bool {
+            return entry.size <= depth + string_sort_cache_bytes;
+        });
+        rtw::intro_sort(equal, unfinished, [](const string_sort_entry& lhs, const string_sort_entry& rhs) -> bool {
+            return lhs.size < rhs.size;
+        });
+        std::size_t unfinished_size = equal + equal_size - unfinished;
+        if(unfinished_size > 1){
+            std::size_t next = depth + string_sort_cache_bytes;
+            for(std::size_t k = 0; k < unfinished_size; ++k){
+                unfinished[k].cache = rtw::string_sort_load(unfinished[k], next);
+            }
+            rtw::string_sort_loop(unfinished, unfinished_size, next, buffer, bad_allowed);
+        }
+
+        rtw::string_sort_loop(entries + greater, size - greater, depth, buffer, bad_allowed);
+        size = less;
+    }
+    rtw::string_sort_insertion(entries, size, depth);
+}
+
+// sorts [first, last) by the bytes of key(element), a std::string_view, compared as unsigned chars like
+// std::string; the keys are sorted as small entries, and the elements are moved once at the end along the
+// cycles of the resulting permutation
+template<typename RandomAccessIterator, typename Key>
+void string_sort(RandomAccessIterator first, RandomAccessIterator last, Key key)
+{
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    difference_type size = last - first;
+    if(size < 2){
+        return;
+    }
+
+    rtw::vector<string_sort_entry> entries(size);
+    for(difference_type i = 0; i < size; ++i){
+        std::string_view view = key(first[i]);
+        entries[i].data = reinterpret_cast<const unsigned char*>(view.data());
+        entries[i].size = view.size();
+        entries[i].index = static_cast<std::size_t>(i);
+        entries[i].cache = rtw::string_sort_load(entries[i], 0);
+    }
+    rtw::vector<string_sort_entry> buffer(size >= string_sort_radix_threshold ? size : 0);
+    rtw::string_sort_loop(&entries[0], static_cast<std::size_t>(size), 0, size >= string_sort_radix_threshold ? &buffer[0] : nullptr, static_cast<int>(rtw::intro_sort_depth_limit(size)) + 8);
+
+    rtw::vector<std::size_t> index(size);
+    for(difference_type i = 0; i < size; ++i){
+        index[i] = entries[i].index;
+    }
+    rtw::apply_permutation(index.begin(), index.end(), first);
+}
+
+template<typename RandomAccessIterator>
+void string_sort(RandomAccessIterator first, RandomAccessIterator last)
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    rtw::string_sort(first, last, [](const value_type& value) -> std::string_view {
+        return std::string_view(value);
+    });
+}
+
+} // namespace rtw
+
+#endif // RTW_STRING_SORT_HPP
@@ -2,14 +2,16 @@
 #define RTW_TIM_SORT_HPP
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
-#include <stack>
 
 #include <rtw/algorithm/insertion_sort.hpp>
 #include <rtw/container/vector.hpp>
 
 namespace rtw{
 
+enum { tim_sort_min_gallop = 7, tim_sort_max_merge_pending = 85 };
+
 template<typename RandomAccessIterator>
 constexpr auto merge_compute_minrun(RandomAccessIterator first, RandomAccessIterator last)
 {
@@ -56,38 +58,421 @@ constexpr auto count_run(RandomAccessIterator first, RandomAccessIterator last,
     }
     return n;
 }
-//void merge_collapse();    // rtw::merge
-//void sortslice_advance();
-//void merge_force_collapse();  // rtw::merge?
 
+// returns k such that base[k - 1] < key <= base[k], starting the search at base[hint]
+template<typename T, typename RandomAccessIterator, typename Size, typename Compare>
+Size gallop_left(const T& key, RandomAccessIterator base, Size n, Size hint, Compare compare)
+{
+    Size last_offset = 0;
+    Size offset = 1;
+    if(compare(base[hint], key)){
+        Size max_offset = n - hint;
+        while(offset < max_offset && compare(base[hint + offset], key)){
+            last_offset = offset;
+            offset = (offset << 1) + 1;
+        }
+        offset = std::min(offset, max_offset);
+        last_offset += hint;
+        offset += hint;
+    }
+    else{
+        Size max_offset = hint + 1;
+        while(offset < max_offset && !compare(base[hint - offset], key)){
+            last_offset = offset;
+            offset = (offset << 1) + 1;
+        }
+        offset = std::min(offset, max_offset);
+        Size k = last_offset;
+        last_offset = hint - offset;
+        offset = hint - k;
+    }
+    ++last_offset;
+    while(last_offset < offset){
+        Size middle = last_offset + ((offset - last_offset) >> 1);
+        if(compare(base[middle], key)){
+            last_offset = middle + 1;
+        }
+        else{
+            offset = middle;
+        }
+    }
+    return offset;
+}
+
+// returns k such that base[k - 1] <= key < base[k], starting the search at base[hint]
+template<typename T, typename RandomAccessIterator, typename Size, typename Compare>
+Size gallop_right(const T& key, RandomAccessIterator base, Size n, Size hint, Compare compare)
+{
+    Size last_offset = 0;
+    Size offset = 1;
+    if(compare(key, base[hint])){
+        Size max_offset = hint + 1;
+        while(offset < max_offset && compare(key, base[hint - offset])){
+            last_offset = offset;
+            offset = (offset << 1) + 1;
+        }
+        offset = std::min(offset, max_offset);
+        Size k = last_offset;
+        last_offset = hint - offset;
+        offset = hint - k;
+    }
+    else{
+        Size max_offset = n - hint;
+        while(offset < max_offset && !compare(key, base[hint + offset])){
+            last_offset = offset;
+            offset = (offset << 1) + 1;
+        }
+        offset = std::min(offset, max_offset);
+        last_offset += hint;
+        offset += hint;
+    }
+    ++last_offset;
+    while(last_offset < offset){
+        Size middle = last_offset + ((offset - last_offset) >> 1);
+        if(compare(key, base[middle])){
+            offset = middle;
+        }
+        else{
+            last_offset = middle + 1;
+        }
+    }
+    return offset;
+}
+
+template<typename RandomAccessIterator>
+struct tim_sort_state{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    struct run{
+        RandomAccessIterator base;
+        difference_type length;
+    };
+    rtw::vector<value_type> buffer;
+    difference_type min_gallop = rtw::tim_sort_min_gallop;
+    run pending[tim_sort_max_merge_pending];
+    std::size_t size = 0;
+
+    auto ensure_buffer(difference_type length){
+        if(static_cast<difference_type>(buffer.size()) < length){
+            buffer.clear();
+            buffer.resize(length);
+        }
+        return buffer.begin();
+    }
+};
+
+// merges a and b in place where a is the shorter run, a[0] > b[0] and a[na - 1] > every element of b
+template<typename RandomAccessIterator, typename Compare>
+void merge_lo(rtw::tim_sort_state<RandomAccessIterator>& state, RandomAccessIterator a, typename std::iterator_traits<RandomAccessIterator>::difference_type na, RandomAccessIterator b, typename std::iterator_traits<RandomAccessIterator>::difference_type nb, Compare compare)
+{
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    auto buffer = state.ensure_buffer(na);
+    std::move(a, a + na, buffer);
+    difference_type i = 0;
+    difference_type j = 0;
+    RandomAccessIterator dest = a;
+    difference_type min_gallop = state.min_gallop;
+
+    *dest++ = std::move(b[j++]);
+    --nb;
+    if(nb == 0){
+        std::move(buffer + i, buffer + i + na, dest);
+        return;
+    }
+    if(na == 1){
+        dest = std::move(b + j, b + j + nb, dest);
+        *dest = std::move(buffer[i]);
+        return;
+    }
+    while(true){
+        difference_type acount = 0;
+        difference_type bcount = 0;
+        // one pair at a time until one run wins consistently
+        while(true){
+            if(compare(b[j], buffer[i])){
+                *dest++ = std::move(b[j++]);
+                ++bcount;
+                acount = 0;
+                if(--nb == 0){
+                    std::move(buffer + i, buffer + i + na, dest);
+                    state.min_gallop = min_gallop;
+                    return;
+                }
+                if(bcount >= min_gallop){
+                    break;
+                }
+            }
+            else{
+                *dest++ = std::move(buffer[i++]);
+                ++acount;
+                bcount = 0;
+                if(--na == 1){
+                    dest = std::move(b + j, b + j + nb, dest);
+                    *dest = std::move(buffer[i]);
+                    state.min_gallop = min_gallop;
+                    return;
+                }
+                if(acount >= min_gallop){
+                    break;
+                }
+            }
+        }
+        // galloping mode
+        ++min_gallop;
+        do{
+            min_gallop -= min_gallop > 1;
+            acount = rtw::gallop_right(b[j], buffer + i, na, difference_type(0), compare);
+            if(acount){
+                dest = std::move(buffer + i, buffer + i + acount, dest);
+                i += acount;
+                na -= acount;
+                if(na == 1){
+                    dest = std::move(b + j, b + j + nb, dest);
+                    *dest = std::move(buffer[i]);
+                    state.min_gallop = min_gallop;
+                    return;
+                }
+                if(na == 0){
+                    state.min_gallop = min_gallop;
+                    return;
+                }
+            }
+            *dest++ = std::move(b[j++]);
+            if(--nb == 0){
+                std::move(buffer + i, buffer + i + na, dest);
+                state.min_gallop = min_gallop;
+                return;
+            }
+            bcount = rtw::gallop_left(buffer[i], b + j, nb, difference_type(0), compare);
+            if(bcount){
+                dest = std::move(b + j, b + j + bcount, dest);
+                j += bcount;
+                nb -= bcount;
+                if(nb == 0){
+                    std::move(buffer + i, buffer + i + na, dest);
+                    state.min_gallop = min_gallop;
+                    return;
+                }
+            }
+            *dest++ = std::move(buffer[i++]);
+            if(--na == 1){
+                dest = std::move(b + j, b + j + nb, dest);
+                *dest = std::move(buffer[i]);
+                state.min_gallop = min_gallop;
+                return;
+            }
+        } while(acount >= rtw::tim_sort_min_gallop || bcount >= rtw::tim_sort_min_gallop);
+        // leaving galloping mode is penalized
+        ++min_gallop;
+    }
+}
+
+// merges a and b in place where b is the shorter run, a[0] > b[0] and a[na - 1] > every element of b
+template<typename RandomAccessIterator, typename Compare>
+void merge_hi(rtw::tim_sort_state<RandomAccessIterator>& state, RandomAccessIterator a, typename std::iterator_traits<RandomAccessIterator>::difference_type na, RandomAccessIterator b, typename std::iterator_traits<RandomAccessIterator>::difference_type nb, Compare compare)
+{
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    auto buffer = state.ensure_buffer(nb);
+    std::move(b, b + nb, buffer);
+    // i and j are one past the last unmerged element of a and of the buffered b, dest is one past the last free slot
+    difference_type i = na;
+    difference_type j = nb;
+    RandomAccessIterator dest = b + nb;
+    difference_type min_gallop = state.min_gallop;
+
+    *--dest = std::move(a[--i]);
+    --na;
+    if(na == 0){
+        std::move(buffer, buffer + nb, dest - nb);
+        return;
+    }
+    if(nb == 1){
+        dest = std::move_backward(a, a + i, dest);
+        *--dest = std::move(buffer[0]);
+        return;
+    }
+    while(true){
+        difference_type acount = 0;
+        difference_type bcount = 0;
+        // one pair at a time until one run wins consistently
+        while(true){
+            if(compare(buffer[j - 1], a[i - 1])){
+                *--dest = std::move(a[--i]);
+                ++acount;
+                bcount = 0;
+                if(--na == 0){
+                    std::move(buffer, buffer + nb, dest - nb);
+                    state.min_gallop = min_gallop;
+                    return;
+                }
+                if(acount >= min_gallop){
+                    break;
+                }
+            }
+            else{
+                *--dest = std::move(buffer[--j]);
+                ++bcount;
+                acount = 0;
+                if(--nb == 1){
+                    dest = std::move_backward(a, a + i, dest);
+                    *--dest = std::move(buffer[0]);
+                    state.min_gallop = min_gallop;
+                    return;
+                }
+                if(bcount >= min_gallop){
+                    break;
+                }
+            }
+        }
+        // galloping mode
+        ++min_gallop;
+        do{
+            min_gallop -= min_gallop > 1;
+            acount = na - rtw::gallop_right(buffer[j - 1], a, na, na - 1, compare);
+            if(acount){
+                dest = std::move_backward(a + i - acount, a + i, dest);
+                i -= acount;
+                na -= acount;
+                if(na == 0){
+                    std::move(buffer, buffer + nb, dest - nb);
+                    state.min_gallop = min_gallop;
+                    return;
+                }
+            }
+            *--dest = std::move(buffer[--j]);
+            if(--nb == 1){
+                dest = std::move_backward(a, a + i, dest);
+                *--dest = std::move(buffer[0]);
+                state.min_gallop = min_gallop;
+                return;
+            }
+            bcount = nb - rtw::gallop_left(a[i - 1], buffer, nb, nb - 1, compare);
+            if(bcount){
+                dest = std::move_backward(buffer + j - bcount, buffer + j, dest);
+                j -= bcount;
+                nb -= bcount;
+                if(nb == 1){
+                    dest = std::move_backward(a, a + i, dest);
+                    *--dest = std::move(buffer[0]);
+                    state.min_gallop = min_gallop;
+                    return;
+                }
+                if(nb == 0){
+                    state.min_gallop = min_gallop;
+                    return;
+                }
+            }
+            *--dest = std::move(a[--i]);
+            if(--na == 0){
+                std::move(buffer, buffer + nb, dest - nb);
+                state.min_gallop = min_gallop;
+                return;
+            }
+        } while(acount >= rtw::tim_sort_min_gallop || bcount >= rtw::tim_sort_min_gallop);
+        // leaving galloping mode is penalized
+        ++min_gallop;
+    }
+}
+
+// merges the pending runs at index n and n + 1
 template<typename RandomAccessIterator, typename Compare>
-constexpr void tim_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+void merge_at(rtw::tim_sort_state<RandomAccessIterator>& state, std::size_t n, Compare compare)
+{
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    RandomAccessIterator a = state.pending[n].base;
+    difference_type na = state.pending[n].length;
+    RandomAccessIterator b = state.pending[n + 1].base;
+    difference_type nb = state.pending[n + 1].length;
+
+    state.pending[n].length = na + nb;
+    if(n + 3 == state.size){
+        state.pending[n + 1] = state.pending[n + 2];
+    }
+    --state.size;
+
+    // elements of a not greater than b[0] and elements of b not less than a[na - 1] are already in place
+    difference_type k = rtw::gallop_right(*b, a, na, difference_type(0), compare);
+    a += k;
+    na -= k;
+    if(na == 0){
+        return;
+    }
+    nb = rtw::gallop_left(a[na - 1], b, nb, nb - 1, compare);
+    if(nb == 0){
+        return;
+    }
+    if(na <= nb){
+        rtw::merge_lo(state, a, na, b, nb, compare);
+    }
+    else{
+        rtw::merge_hi(state, a, na, b, nb, compare);
+    }
+}
+
+// keeps the run lengths on the stack satisfying len[i - 2] > len[i - 1] + len[i] and len[i - 1] > len[i]
+template<typename RandomAccessIterator, typename Compare>
+void merge_collapse(rtw::tim_sort_state<RandomAccessIterator>& state, Compare compare)
+{
+    auto& p = state.pending;
+    while(state.size > 1){
+        std::size_t n = state.size - 2;
+        if((n > 0 && p[n - 1].length <= p[n].length + p[n + 1].length) || (n > 1 && p[n - 2].length <= p[n - 1].length + p[n].length)){
+            if(p[n - 1].length < p[n + 1].length){
+                --n;
+            }
+        }
+        else if(p[n].length > p[n + 1].length){
+            break;
+        }
+        rtw::merge_at(state, n, compare);
+    }
+}
+
+template<typename RandomAccessIterator, typename Compare>
+void merge_force_collapse(rtw::tim_sort_state<RandomAccessIterator>& state, Compare compare)
+{
+    auto& p = state.pending;
+    while(state.size > 1){
+        std::size_t n = state.size - 2;
+        if(n > 0 && p[n - 1].length < p[n + 1].length){
+            --n;
+        }
+        rtw::merge_at(state, n, compare);
+    }
+}
+
+template<typename RandomAccessIterator, typename Compare>
+void tim_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
 {
     using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
-    difference_type minrun = merge_compute_minrun(first, last);
     difference_type remaining = std::distance(first, last);
-    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
-    rtw::vector<value_type> buffer(remaining);
+    if(remaining < 2){
+        return;
+    }
+    difference_type minrun = rtw::merge_compute_minrun(first, last);
+    rtw::tim_sort_state<RandomAccessIterator> state;
     do{
         bool descending = false;
-        difference_type n = count_run(first, last, compare, descending);
+        difference_type n = rtw::count_run(first, first + remaining, compare, descending);
         if(descending){
             std::reverse(first, first + n);
         }
         if(n < minrun){
-            difference_type force = remaining <= minrun ? remaining : minrun;
+            n = remaining <= minrun ? remaining : minrun;
             rtw::insertion_sort(first, first + n, compare);
-            n = force;
         }
-
-
-
+        state.pending[state.size].base = first;
+        state.pending[state.size].length = n;
+        ++state.size;
+        rtw::merge_collapse(state, compare);
+        first += n;
         remaining -= n;
-    } while(remaining >= 0);
+    } while(remaining > 0);
+    rtw::merge_force_collapse(state, compare);
 }
 
 template<typename RandomAccessIterator>
-constexpr void tim_sort(RandomAccessIterator first, RandomAccessIterator last)
+void tim_sort(RandomAccessIterator first, RandomAccessIterator last)
 {
     using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
     rtw::tim_sort(first, last, std::less<value_type>());
@@ -0,0 +1,168 @@
+#ifndef RTW_LOSER_TREE_HPP
+#define RTW_LOSER_TREE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <rtw/container/vector.hpp>
+
+namespace rtw{
+
+// tournament tree over a fixed number of sources, each holding one key or being exhausted.
+// Every internal node keeps the loser of the match played there and node 0 the overall winner,
+// so replacing the winner replays only its path to the root: ceil(log2(k)) comparisons.
+// Equal keys are won by the source with the smaller index, which makes merging with it stable.
+template<typename T, typename Compare = std::less<T>>
+class loser_tree{
+public:
+    using value_type = T;
+    using value_compare = Compare;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+private:
+    rtw::vector<T> keys_;
+    rtw::vector<unsigned char> exhausted_;
+    rtw::vector<size_type> tree_;
+    size_type active_;
+    Compare comp_;
+public:
+    // constructor
+    explicit loser_tree(size_type sources, const Compare& compare = Compare())
+    : keys_(sources)
+    , exhausted_(sources, 1)
+    , tree_(sources > 0 ? sources : 1, 0)
+    , active_(0)
+    , comp_(compare){}
+
+    // one source per key of [first, last), all active
+    template<typename InputIterator>
+    loser_tree(InputIterator first, InputIterator last, const Compare& compare = Compare())
+    : keys_(first, last)
+    , exhausted_(keys_.size(), 0)
+    , tree_(keys_.size() > 0 ? keys_.size() : 1, 0)
+    , active_(keys_.size())
+    , comp_(compare){
+        build();
+    }
+
+    loser_tree(const loser_tree& other) = default;
+    loser_tree(loser_tree&& other) = default;
+
+    // operator=
+    loser_tree& operator=(const loser_tree& other) = default;
+    loser_tree& operator=(loser_tree&& other) = default;
+
+    // destructor
+    ~loser_tree() = default;
+public:
+    // element access
+    const_reference top() const{
+        return keys_[tree_[0]];
+    }
+    // the source whose key is top()
+    size_type top_source() const{
+        return tree_[0];
+    }
+
+    // capacity
+    bool empty() const noexcept{
+        return active_ == 0;
+    }
+    // the number of sources that are not exhausted
+    size_type size() const noexcept{
+        return active_;
+    }
+    size_type sources() const noexcept{
+        return keys_.size();
+    }
+
+    // modifiers
+    // gives the winner its next key
+    void replace_top(const value_type& value){
+        keys_[tree_[0]] = value;
+        replay(tree_[0]);
+    }
+    void replace_top(value_type&& value){
+        keys_[tree_[0]] = std::move(value);
+        replay(tree_[0]);
+    }
+    // exhausts the winner
+    void pop(){
+        exhausted_[tree_[0]] = 1;
+        --active_;
+        replay(tree_[0]);
+    }
+    // activates an exhausted source with a key; the matches it may now win are not on a single path,
+    // so the whole tree is rebuilt in O(k)
+    void push(size_type source, const value_type& value){
+        keys_[source] = value;
+        exhausted_[source] = 0;
+        ++active_;
+        build();
+    }
+    void push(size_type source, value_type&& value){
+        keys_[source] = std::move(value);
+        exhausted_[source] = 0;
+        ++active_;
+        build();
+    }
+    void swap(loser_tree& other) noexcept(std::is_nothrow_swappable_v<Compare>){
+        using std::swap;
+        swap(keys_, other.keys_);
+        swap(exhausted_, other.exhausted_);
+        swap(tree_, other.tree_);
+        swap(active_, other.active_);
+        swap(comp_, other.comp_);
+    }
+private:
+    // whether source lhs beats source rhs, exhausted sources losing to everything
+    bool wins(size_type lhs, size_type rhs) const{
+        if(exhausted_[lhs] || exhausted_[rhs]){
+            return exhausted_[rhs] && (!exhausted_[lhs] || lhs < rhs);
+        }
+        // one comparison decides, ties going to the smaller index
+        return lhs < rhs ? !comp_(keys_[rhs], keys_[lhs]) : comp_(keys_[lhs], keys_[rhs]);
+    }
+    // leaf i sits at node k + i of the implicit tree, the parent of node n being n / 2
+    void build(){
+        size_type k = keys_.size();
+        if(k < 2){
+            tree_[0] = 0;
+            return;
+        }
+        rtw::vector<size_type> winners(2 * k);
+        for(size_type i = 0; i < k; ++i){
+            winners[k + i] = i;
+        }
+        for(size_type node = k - 1; node > 0; --node){
+            size_type lhs = winners[2 * node];
+            size_type rhs = winners[2 * node + 1];
+            bool left = wins(lhs, rhs);
+            winners[node] = left ? lhs : rhs;
+            tree_[node] = left ? rhs : lhs;
+        }
+        tree_[0] = winners[1];
+    }
+    // the winner's key changed: it plays the stored losers on its way up
+    void replay(size_type source){
+        size_type winner = source;
+        for(size_type node = (keys_.size() + source) / 2; node > 0; node /= 2){
+            if(wins(tree_[node], winner)){
+                std::swap(tree_[node], winner);
+            }
+        }
+        tree_[0] = winner;
+    }
+};
+
+template<typename T, typename Compare>
+void swap(rtw::loser_tree<T, Compare>& lhs, rtw::loser_tree<T, Compare>& rhs) noexcept(noexcept(lhs.swap(rhs))){
+    lhs.swap(rhs);
+}
+
+} // namespace rtw
+
+#endif // RTW_LOSER_TREE_HPP
\ No newline at end of file
@@ -1,6 +1,7 @@
 #ifndef RTW_PRIORITY_QUEUE_HPP
 #define RTW_PRIORITY_QUEUE_HPP
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <type_traits>
@@ -11,7 +12,9 @@
 
 namespace rtw{
 
-template<typename T, typename Container = rtw::vector<T>, typename Compare = std::less<typename Container::value_type>>
+// a d-ary heap of Arity children per node over Container; 4 or 8 make the heap shallower and keep the children
+// of a node together, which pays off for large queues of small elements
+template<typename T, typename Container = rtw::vector<T>, typename Compare = std::less<typename Container::value_type>, std::size_t Arity = 2>
 class priority_queue{
 public:
     using container_type = Container;
@@ -20,6 +23,7 @@ public:
     using size_type = typename Container::size_type;
     using reference = typename Container::reference;
     using const_reference = typename Container::const_reference;
+    static constexpr std::size_t arity = Arity;
 protected:
     Container c;
     Compare comp;
@@ -34,13 +38,13 @@ public:
     priority_queue(const Compare& compare, const Container& container)
     : c(container)
     , comp(compare){
-        rtw::make_heap(c.begin(), c.end(), comp);
+        rtw::make_heap<Arity>(c.begin(), c.end(), comp);
     }
 
     priority_queue(const Compare& compare, Container&& container)
     : c(std::move(container))
     , comp(compare){
-        rtw::make_heap(c.begin(), c.end(), comp);
+        rtw::make_heap<Arity>(c.begin(), c.end(), comp);
     }
 
     priority_queue(const priority_queue& other) = default;
@@ -60,14 +64,14 @@ public:
     priority_queue(const Compare& compare, const Container& container, const Allocator& allocator)
     : c(container, allocator)
     , comp(compare){
-        rtw::make_heap(c.begin(), c.end(), comp);
+        rtw::make_heap<Arity>(c.begin(), c.end(), comp);
     }
 
     template<typename Allocator>
     priority_queue(const Compare& compare, Container&& container, const Allocator& allocator)
     : c(std::move(container), allocator)
     , comp(compare){
-        rtw::make_heap(c.begin(), c.end(), comp);
+        rtw::make_heap<Arity>(c.begin(), c.end(), comp);
     }
 
     template<typename Allocator>
@@ -85,7 +89,7 @@ public:
     : c(container)
     , comp(compare){
         c.insert(c.end(), first, last);
-        rtw::make_heap(c.begin(), c.end(), comp);
+        rtw::make_heap<Arity>(c.begin(), c.end(), comp);
     }
 
     template<typename InputIterator>
@@ -93,7 +97,7 @@ public:
     : c(std::move(container))
     , comp(compare){
         c.insert(c.end(), first, last);
-        rtw::make_heap(c.begin(), c.end(), comp);
+        rtw::make_heap<Arity>(c.begin(), c.end(), comp);
     }
 
     // operator=
@@ -114,19 +118,19 @@ public:
     }
     void push(const value_type& value){
         c.push_back(value);
-        rtw::push_heap(c.begin(), c.end(), comp);
+        rtw::push_heap<Arity>(c.begin(), c.end(), comp);
     }
     void push(value_type&& value){
         c.push_back(std::move(value));
-        rtw::push_heap(c.begin(), c.end(), comp);
+        rtw::push_heap<Arity>(c.begin(), c.end(), comp);
     }
     template<typename... Args>
     void emplace(Args&&... args){
         c.emplace_back(std::forward<Args>(args)...);
-        rtw::push_heap(c.begin(), c.end(), comp);
+        rtw::push_heap<Arity>(c.begin(), c.end(), comp);
     }
     void pop(){
-        rtw::pop_heap(c.begin(), c.end(), comp);
+        rtw::pop_heap<Arity>(c.begin(), c.end(), comp);
         c.pop_back();
     }
     void swap(priority_queue& other) noexcept(std::is_nothrow_swappable_v<Container> && std::is_nothrow_swappable_v<Compare>){
@@ -136,8 +140,8 @@ public:
     }
 };
 
-template<typename T, typename Container, typename Compare>
-void swap(rtw::priority_queue<T, Container, Compare>& lhs, rtw::priority_queue<T, Container, Compare>& rhs) noexcept(noexcept(lhs.swap(rhs))){
+template<typename T, typename Container, typename Compare, std::size_t Arity>
+void swap(rtw::priority_queue<T, Container, Compare, Arity>& lhs, rtw::priority_queue<T, Container, Compare, Arity>& rhs) noexcept(noexcept(lhs.swap(rhs))){
     lhs.swap(rhs);
 }
 
@@ -153,8 +157,8 @@ priority_queue(Compare, Container, Allocator)->priority_queue<typename Container
 } // namespace rtw
 
 namespace std{
-    template<typename T, typename Container, typename Compare, typename Allocator>
-    struct uses_allocator<rtw::priority_queue<T, Container, Compare>, Allocator> : public std::uses_allocator<Container, Allocator>::type{};
+    template<typename T, typename Container, typename Compare, std::size_t Arity, typename Allocator>
+    struct uses_allocator<rtw::priority_queue<T, Container, Compare, Arity>, Allocator> : public std::uses_allocator<Container, Allocator>::type{};
 } // namespace std
 
 #endif // RTW_PRIORITY_QUEUE_HPP
\ No newline at end of file
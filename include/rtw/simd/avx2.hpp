@@ -0,0 +1,315 @@
+#ifndef RTW_SIMD_AVX2_HPP
+#define RTW_SIMD_AVX2_HPP
+
+#include <rtw/simd/isa.hpp>
+
+#if defined(RTW_SIMD_X86)
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <rtw/algorithm/heap.hpp>
+
+// everything up to the matching pop is compiled for AVX2 whatever the command line says,
+// it is only ever called after detect_simd_isa() has reported AVX2
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2,popcnt"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2,popcnt")
+#endif
+
+namespace rtw{
+namespace avx2{
+
+// AVX2 has no compress-store, a lookup table gives for every lane mask the 32-bit lane permutation
+// that moves the lanes outside the mask to the front and the lanes in the mask to the back
+struct compress_table_type{
+    unsigned char index[256][8];
+};
+
+constexpr compress_table_type make_compress_table(int lanes)
+{
+    compress_table_type table{};
+    int width = 8 / lanes;
+    for(int mask = 0; mask < (1 << lanes); ++mask){
+        int position = 0;
+        for(int pass = 0; pass < 2; ++pass){
+            for(int lane = 0; lane < lanes; ++lane){
+                if(((mask >> lane) & 1) == pass){
+                    for(int part = 0; part < width; ++part){
+                        table.index[mask][position++] = static_cast<unsigned char>(lane * width + part);
+                    }
+                }
+            }
+        }
+    }
+    return table;
+}
+
+inline constexpr compress_table_type compress_table32 = make_compress_table(8);
+inline constexpr compress_table_type compress_table64 = make_compress_table(4);
+
+inline __m256i compress_index(const compress_table_type& table, unsigned mask)
+{
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(table.index[mask])));
+}
+
+inline __m256i lane_mask32(int n)
+{
+    return _mm256_cmpgt_epi32(_mm256_set1_epi32(n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+}
+
+inline __m256i lane_mask64(int n)
+{
+    return _mm256_cmpgt_epi64(_mm256_set1_epi64x(n), _mm256_setr_epi64x(0, 1, 2, 3));
+}
+
+inline __m256i bits_to_mask32(unsigned mask)
+{
+    __m256i bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    return _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(static_cast<int>(mask)), bits), bits);
+}
+
+inline __m256i bits_to_mask64(unsigned mask)
+{
+    __m256i bits = _mm256_setr_epi64x(1, 2, 4, 8);
+    return _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(mask), bits), bits);
+}
+
+// 32-bit lane indices that exchange every element with element ^ j, for elements of the given size
+inline __m256i xor_index(int j, std::size_t size)
+{
+    int stride = static_cast<int>(size / 4);
+    return _mm256_xor_si256(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(j * stride));
+}
+
+template<typename T>
+struct vector_traits;
+
+// 32-bit integers, the unsigned ones are compared after flipping the sign bit
+template<typename T>
+struct vector_traits_int32{
+    using reg = __m256i;
+    static constexpr int lanes = 8;
+    static constexpr unsigned full = 0xFF;
+
+    static reg set1(T x){
+        return _mm256_set1_epi32(static_cast<int>(x));
+    }
+    static reg load(const T* p){
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+    static void store(T* p, reg v){
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+    }
+    static reg load_partial(const T* p, int n, reg fill){
+        __m256i mask = lane_mask32(n);
+        return _mm256_blendv_epi8(fill, _mm256_maskload_epi32(reinterpret_cast<const int*>(p), mask), mask);
+    }
+    static void store_partial(T* p, int n, reg v){
+        _mm256_maskstore_epi32(reinterpret_cast<int*>(p), lane_mask32(n), v);
+    }
+    static reg min(reg a, reg b){
+        return std::is_signed<T>::value ? _mm256_min_epi32(a, b) : _mm256_min_epu32(a, b);
+    }
+    static reg max(reg a, reg b){
+        return std::is_signed<T>::value ? _mm256_max_epi32(a, b) : _mm256_max_epu32(a, b);
+    }
+    static unsigned greater_mask(reg a, reg b){
+        if(!std::is_signed<T>::value){
+            __m256i sign = _mm256_set1_epi32(std::numeric_limits<int>::min());
+            a = _mm256_xor_si256(a, sign);
+            b = _mm256_xor_si256(b, sign);
+        }
+        return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(a, b)));
+    }
+    static unsigned greater_equal_mask(reg a, reg b){
+        return ~greater_mask(b, a) & full;
+    }
+    static reg swap_lanes(reg v, int j){
+        return _mm256_permutevar8x32_epi32(v, xor_index(j, sizeof(T)));
+    }
+    static reg blend(reg a, reg b, unsigned mask){
+        return _mm256_blendv_epi8(a, b, bits_to_mask32(mask));
+    }
+    static void partition_store(T* left, T* right_end, reg v, unsigned mask){
+        reg permuted = _mm256_permutevar8x32_epi32(v, compress_index(compress_table32, mask));
+        store(left, permuted);
+        store(right_end - lanes, permuted);
+    }
+};
+
+template<>
+struct vector_traits<std::int32_t> : vector_traits_int32<std::int32_t>{};
+
+template<>
+struct vector_traits<std::uint32_t> : vector_traits_int32<std::uint32_t>{};
+
+template<>
+struct vector_traits<std::int64_t>{
+    using T = std::int64_t;
+    using reg = __m256i;
+    static constexpr int lanes = 4;
+    static constexpr unsigned full = 0xF;
+
+    static reg set1(T x){
+        return _mm256_set1_epi64x(x);
+    }
+    static reg load(const T* p){
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+    static void store(T* p, reg v){
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+    }
+    static reg load_partial(const T* p, int n, reg fill){
+        __m256i mask = lane_mask64(n);
+        return _mm256_blendv_epi8(fill, _mm256_maskload_epi64(reinterpret_cast<const long long*>(p), mask), mask);
+    }
+    static void store_partial(T* p, int n, reg v){
+        _mm256_maskstore_epi64(reinterpret_cast<long long*>(p), lane_mask64(n), v);
+    }
+    static reg min(reg a, reg b){
+        return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b));
+    }
+    static reg max(reg a, reg b){
+        return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b));
+    }
+    static unsigned greater_mask(reg a, reg b){
+        return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(a, b)));
+    }
+    static unsigned greater_equal_mask(reg a, reg b){
+        return ~greater_mask(b, a) & full;
+    }
+    static reg swap_lanes(reg v, int j){
+        return _mm256_permutevar8x32_epi32(v, xor_index(j, sizeof(T)));
+    }
+    static reg blend(reg a, reg b, unsigned mask){
+        return _mm256_blendv_epi8(a, b, bits_to_mask64(mask));
+    }
+    static void partition_store(T* left, T* right_end, reg v, unsigned mask){
+        reg permuted = _mm256_permutevar8x32_epi32(v, compress_index(compress_table64, mask));
+        store(left, permuted);
+        store(right_end - lanes, permuted);
+    }
+};
+
+template<>
+struct vector_traits<float>{
+    using T = float;
+    using reg = __m256;
+    static constexpr int lanes = 8;
+    static constexpr unsigned full = 0xFF;
+
+    static reg set1(T x){
+        return _mm256_set1_ps(x);
+    }
+    static reg load(const T* p){
+        return _mm256_loadu_ps(p);
+    }
+    static void store(T* p, reg v){
+        _mm256_storeu_ps(p, v);
+    }
+    static reg load_partial(const T* p, int n, reg fill){
+        __m256i mask = lane_mask32(n);
+        return _mm256_blendv_ps(fill, _mm256_maskload_ps(p, mask), _mm256_castsi256_ps(mask));
+    }
+    static void store_partial(T* p, int n, reg v){
+        _mm256_maskstore_ps(p, lane_mask32(n), v);
+    }
+    static reg min(reg a, reg b){
+        return _mm256_min_ps(a, b);
+    }
+    static reg max(reg a, reg b){
+        return _mm256_max_ps(a, b);
+    }
+    static unsigned greater_mask(reg a, reg b){
+        return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GT_OQ));
+    }
+    static unsigned greater_equal_mask(reg a, reg b){
+        return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GE_OQ));
+    }
+    static reg swap_lanes(reg v, int j){
+        return _mm256_permutevar8x32_ps(v, xor_index(j, sizeof(T)));
+    }
+    static reg blend(reg a, reg b, unsigned mask){
+        return _mm256_blendv_ps(a, b, _mm256_castsi256_ps(bits_to_mask32(mask)));
+    }
+    static void partition_store(T* left, T* right_end, reg v, unsigned mask){
+        reg permuted = _mm256_permutevar8x32_ps(v, compress_index(compress_table32, mask));
+        store(left, permuted);
+        store(right_end - lanes, permuted);
+    }
+};
+
+template<>
+struct vector_traits<double>{
+    using T = double;
+    using reg = __m256d;
+    static constexpr int lanes = 4;
+    static constexpr unsigned full = 0xF;
+
+    static reg set1(T x){
+        return _mm256_set1_pd(x);
+    }
+    static reg load(const T* p){
+        return _mm256_loadu_pd(p);
+    }
+    static void store(T* p, reg v){
+        _mm256_storeu_pd(p, v);
+    }
+    static reg load_partial(const T* p, int n, reg fill){
+        __m256i mask = lane_mask64(n);
+        return _mm256_blendv_pd(fill, _mm256_maskload_pd(p, mask), _mm256_castsi256_pd(mask));
+    }
+    static void store_partial(T* p, int n, reg v){
+        _mm256_maskstore_pd(p, lane_mask64(n), v);
+    }
+    static reg min(reg a, reg b){
+        return _mm256_min_pd(a, b);
+    }
+    static reg max(reg a, reg b){
+        return _mm256_max_pd(a, b);
+    }
+    static unsigned greater_mask(reg a, reg b){
+        return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GT_OQ));
+    }
+    static unsigned greater_equal_mask(reg a, reg b){
+        return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GE_OQ));
+    }
+    static reg swap_lanes(reg v, int j){
+        return _mm256_castsi256_pd(_mm256_permutevar8x32_epi32(_mm256_castpd_si256(v), xor_index(j, sizeof(T))));
+    }
+    static reg blend(reg a, reg b, unsigned mask){
+        return _mm256_blendv_pd(a, b, _mm256_castsi256_pd(bits_to_mask64(mask)));
+    }
+    static void partition_store(T* left, T* right_end, reg v, unsigned mask){
+        reg permuted = _mm256_castsi256_pd(_mm256_permutevar8x32_epi32(_mm256_castpd_si256(v), compress_index(compress_table64, mask)));
+        store(left, permuted);
+        store(right_end - lanes, permuted);
+    }
+};
+
+#include <rtw/simd/sort_kernel.ipp>
+#include <rtw/simd/reduce_kernel.ipp>
+#include <rtw/simd/search_kernel.ipp>
+
+} // namespace avx2
+} // namespace rtw
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#endif // RTW_SIMD_X86
+
+#endif // RTW_SIMD_AVX2_HPP
@@ -0,0 +1,245 @@
+#ifndef RTW_SIMD_AVX512_HPP
+#define RTW_SIMD_AVX512_HPP
+
+#include <rtw/simd/isa.hpp>
+
+#if defined(RTW_SIMD_X86)
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <rtw/algorithm/heap.hpp>
+
+// everything up to the matching pop is compiled for AVX-512F whatever the command line says,
+// it is only ever called after detect_simd_isa() has reported AVX-512
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx512f,avx2,popcnt"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx2,popcnt")
+// the _mm512_undefined_* helpers of GCC 12 initialize a register with itself, which trips these once inlined
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace rtw{
+namespace avx512{
+
+template<typename T>
+struct vector_traits;
+
+// 16 lanes of 32 bits, the unsigned variant only differs in its comparisons
+template<typename T>
+struct vector_traits_int32{
+    using reg = __m512i;
+    static constexpr int lanes = 16;
+
+    static reg set1(T x){
+        return _mm512_set1_epi32(static_cast<int>(x));
+    }
+    static reg load(const T* p){
+        return _mm512_loadu_si512(p);
+    }
+    static void store(T* p, reg v){
+        _mm512_storeu_si512(p, v);
+    }
+    static reg load_partial(const T* p, int n, reg fill){
+        return _mm512_mask_loadu_epi32(fill, static_cast<__mmask16>((1u << n) - 1), p);
+    }
+    static void store_partial(T* p, int n, reg v){
+        _mm512_mask_storeu_epi32(p, static_cast<__mmask16>((1u << n) - 1), v);
+    }
+    static reg min(reg a, reg b){
+        return std::is_signed<T>::value ? _mm512_min_epi32(a, b) : _mm512_min_epu32(a, b);
+    }
+    static reg max(reg a, reg b){
+        return std::is_signed<T>::value ? _mm512_max_epi32(a, b) : _mm512_max_epu32(a, b);
+    }
+    static unsigned greater_mask(reg a, reg b){
+        return std::is_signed<T>::value ? _mm512_cmpgt_epi32_mask(a, b) : _mm512_cmpgt_epu32_mask(a, b);
+    }
+    static unsigned greater_equal_mask(reg a, reg b){
+        return std::is_signed<T>::value ? _mm512_cmpge_epi32_mask(a, b) : _mm512_cmpge_epu32_mask(a, b);
+    }
+    static reg swap_lanes(reg v, int j){
+        __m512i index = _mm512_xor_si512(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32(j));
+        return _mm512_permutexvar_epi32(index, v);
+    }
+    static reg blend(reg a, reg b, unsigned mask){
+        return _mm512_mask_blend_epi32(static_cast<__mmask16>(mask), a, b);
+    }
+    static void partition_store(T* left, T* right_end, reg v, unsigned mask){
+        _mm512_mask_compressstoreu_epi32(left, static_cast<__mmask16>(~mask), v);
+        _mm512_mask_compressstoreu_epi32(right_end - __builtin_popcount(mask), static_cast<__mmask16>(mask), v);
+    }
+};
+
+template<>
+struct vector_traits<std::int32_t> : vector_traits_int32<std::int32_t>{};
+
+template<>
+struct vector_traits<std::uint32_t> : vector_traits_int32<std::uint32_t>{};
+
+template<>
+struct vector_traits<std::int64_t>{
+    using T = std::int64_t;
+    using reg = __m512i;
+    static constexpr int lanes = 8;
+
+    static reg set1(T x){
+        return _mm512_set1_epi64(x);
+    }
+    static reg load(const T* p){
+        return _mm512_loadu_si512(p);
+    }
+    static void store(T* p, reg v){
+        _mm512_storeu_si512(p, v);
+    }
+    static reg load_partial(const T* p, int n, reg fill){
+        return _mm512_mask_loadu_epi64(fill, static_cast<__mmask8>((1u << n) - 1), p);
+    }
+    static void store_partial(T* p, int n, reg v){
+        _mm512_mask_storeu_epi64(p, static_cast<__mmask8>((1u << n) - 1), v);
+    }
+    static reg min(reg a, reg b){
+        return _mm512_min_epi64(a, b);
+    }
+    static reg max(reg a, reg b){
+        return _mm512_max_epi64(a, b);
+    }
+    static unsigned greater_mask(reg a, reg b){
+        return _mm512_cmpgt_epi64_mask(a, b);
+    }
+    static unsigned greater_equal_mask(reg a, reg b){
+        return _mm512_cmpge_epi64_mask(a, b);
+    }
+    static reg swap_lanes(reg v, int j){
+        __m512i index = _mm512_xor_si512(_mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7), _mm512_set1_epi64(j));
+        return _mm512_permutexvar_epi64(index, v);
+    }
+    static reg blend(reg a, reg b, unsigned mask){
+        return _mm512_mask_blend_epi64(static_cast<__mmask8>(mask), a, b);
+    }
+    static void partition_store(T* left, T* right_end, reg v, unsigned mask){
+        _mm512_mask_compressstoreu_epi64(left, static_cast<__mmask8>(~mask), v);
+        _mm512_mask_compressstoreu_epi64(right_end - __builtin_popcount(mask), static_cast<__mmask8>(mask), v);
+    }
+};
+
+template<>
+struct vector_traits<float>{
+    using T = float;
+    using reg = __m512;
+    static constexpr int lanes = 16;
+
+    static reg set1(T x){
+        return _mm512_set1_ps(x);
+    }
+    static reg load(const T* p){
+        return _mm512_loadu_ps(p);
+    }
+    static void store(T* p, reg v){
+        _mm512_storeu_ps(p, v);
+    }
+    static reg load_partial(const T* p, int n, reg fill){
+        return _mm512_mask_loadu_ps(fill, static_cast<__mmask16>((1u << n) - 1), p);
+    }
+    static void store_partial(T* p, int n, reg v){
+        _mm512_mask_storeu_ps(p, static_cast<__mmask16>((1u << n) - 1), v);
+    }
+    static reg min(reg a, reg b){
+        return _mm512_min_ps(a, b);
+    }
+    static reg max(reg a, reg b){
+        return _mm512_max_ps(a, b);
+    }
+    static unsigned greater_mask(reg a, reg b){
+        return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ);
+    }
+    static unsigned greater_equal_mask(reg a, reg b){
+        return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ);
+    }
+    static reg swap_lanes(reg v, int j){
+        __m512i index = _mm512_xor_si512(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32(j));
+        return _mm512_permutexvar_ps(index, v);
+    }
+    static reg blend(reg a, reg b, unsigned mask){
+        return _mm512_mask_blend_ps(static_cast<__mmask16>(mask), a, b);
+    }
+    static void partition_store(T* left, T* right_end, reg v, unsigned mask){
+        _mm512_mask_compressstoreu_ps(left, static_cast<__mmask16>(~mask), v);
+        _mm512_mask_compressstoreu_ps(right_end - __builtin_popcount(mask), static_cast<__mmask16>(mask), v);
+    }
+};
+
+template<>
+struct vector_traits<double>{
+    using T = double;
+    using reg = __m512d;
+    static constexpr int lanes = 8;
+
+    static reg set1(T x){
+        return _mm512_set1_pd(x);
+    }
+    static reg load(const T* p){
+        return _mm512_loadu_pd(p);
+    }
+    static void store(T* p, reg v){
+        _mm512_storeu_pd(p, v);
+    }
+    static reg load_partial(const T* p, int n, reg fill){
+        return _mm512_mask_loadu_pd(fill, static_cast<__mmask8>((1u << n) - 1), p);
+    }
+    static void store_partial(T* p, int n, reg v){
+        _mm512_mask_storeu_pd(p, static_cast<__mmask8>((1u << n) - 1), v);
+    }
+    static reg min(reg a, reg b){
+        return _mm512_min_pd(a, b);
+    }
+    static reg max(reg a, reg b){
+        return _mm512_max_pd(a, b);
+    }
+    static unsigned greater_mask(reg a, reg b){
+        return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ);
+    }
+    static unsigned greater_equal_mask(reg a, reg b){
+        return _mm512_cmp_pd_mask(a, b, _CMP_GE_OQ);
+    }
+    static reg swap_lanes(reg v, int j){
+        __m512i index = _mm512_xor_si512(_mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7), _mm512_set1_epi64(j));
+        return _mm512_permutexvar_pd(index, v);
+    }
+    static reg blend(reg a, reg b, unsigned mask){
+        return _mm512_mask_blend_pd(static_cast<__mmask8>(mask), a, b);
+    }
+    static void partition_store(T* left, T* right_end, reg v, unsigned mask){
+        _mm512_mask_compressstoreu_pd(left, static_cast<__mmask8>(~mask), v);
+        _mm512_mask_compressstoreu_pd(right_end - __builtin_popcount(mask), static_cast<__mmask8>(mask), v);
+    }
+};
+
+#include <rtw/simd/sort_kernel.ipp>
+#include <rtw/simd/reduce_kernel.ipp>
+#include <rtw/simd/search_kernel.ipp>
+
+} // namespace avx512
+} // namespace rtw
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC diagnostic pop
+#pragma GCC pop_options
+#endif
+
+#endif // RTW_SIMD_X86
+
+#endif // RTW_SIMD_AVX512_HPP
@@ -0,0 +1,58 @@
+#ifndef RTW_SIMD_ISA_HPP
+#define RTW_SIMD_ISA_HPP
+
+#include <atomic>
+
+// the vector kernels are compiled for their own target inside ordinary translation units,
+// which needs the GCC/Clang target attributes and is only done for x86-64
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define RTW_SIMD_X86 1
+#endif
+
+namespace rtw{
+
+// instruction set levels, ordered so that a higher level implies the lower ones; SSE2, part of x86-64, only has
+// the reductions of min_element and its relatives and the node search of static_btree, the sorts start at AVX2
+enum class simd_isa : int { scalar = 0, sse2 = 1, avx2 = 2, avx512 = 3 };
+
+// the best level the running CPU and OS support
+inline simd_isa detect_simd_isa() noexcept
+{
+#if defined(RTW_SIMD_X86)
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("popcnt")){
+        return simd_isa::avx512;
+    }
+    if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")){
+        return simd_isa::avx2;
+    }
+    return simd_isa::sse2;
+#endif
+    return simd_isa::scalar;
+}
+
+inline std::atomic<int>& simd_isa_state() noexcept
+{
+    static std::atomic<int> state(static_cast<int>(rtw::detect_simd_isa()));
+    return state;
+}
+
+// the level the algorithms dispatch to
+inline simd_isa simd_isa_level() noexcept
+{
+    return static_cast<simd_isa>(rtw::simd_isa_state().load(std::memory_order_relaxed));
+}
+
+// lowers (or restores) the level the algorithms dispatch to, it is clamped to what the CPU supports;
+// returns the level that is now in effect
+inline simd_isa set_simd_isa(simd_isa isa) noexcept
+{
+    simd_isa supported = rtw::detect_simd_isa();
+    simd_isa level = static_cast<int>(isa) < static_cast<int>(supported) ? isa : supported;
+    rtw::simd_isa_state().store(static_cast<int>(level), std::memory_order_relaxed);
+    return level;
+}
+
+} // namespace rtw
+
+#endif // RTW_SIMD_ISA_HPP
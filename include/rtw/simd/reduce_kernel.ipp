@@ -0,0 +1,192 @@
+// Vectorized min, max and minmax element, written once against vector_traits<T> and included by each
+// instruction set header inside its own namespace and target region (no include guard on purpose).
+//
+// vector_traits<T> provides, for a register reg of lanes elements:
+//   set1, load, store, min, max and greater_equal_mask(a, b) as a lane bit mask.
+//
+// The range is reduced in blocks of reduce_kernel_block elements with four accumulators; only the block in which
+// the extremum was first reached is scanned again for its position, so the result is the first occurrence at the
+// cost of one pass. NaNs leave the order undefined: the kernels then return n and the caller falls back to its loop.
+
+enum { reduce_kernel_block = 1 << 12 };
+
+// lanes of v that are not NaN, all of them for integers
+template<typename T>
+inline unsigned reduce_kernel_ordered(typename vector_traits<T>::reg v)
+{
+    if constexpr(std::is_floating_point<T>::value){
+        return vector_traits<T>::greater_equal_mask(v, v);
+    }
+    else{
+        static_cast<void>(v);
+        return (1u << vector_traits<T>::lanes) - 1;
+    }
+}
+
+// the minimum and maximum of [first, first + n), n > 0, each only if wanted; false when a NaN is met
+template<bool Min, bool Max, typename T>
+inline bool reduce_block(const T* first, std::size_t n, T& min, T& max)
+{
+    using traits = vector_traits<T>;
+    using reg = typename traits::reg;
+    constexpr std::size_t lanes = traits::lanes;
+    constexpr unsigned all = (1u << traits::lanes) - 1;
+    unsigned ordered = all;
+    std::size_t i = 0;
+    min = first[0];
+    max = first[0];
+    if(n >= 4 * lanes){
+        reg v0 = traits::load(first);
+        reg v1 = traits::load(first + lanes);
+        reg v2 = traits::load(first + 2 * lanes);
+        reg v3 = traits::load(first + 3 * lanes);
+        ordered &= reduce_kernel_ordered<T>(v0) & reduce_kernel_ordered<T>(v1) & reduce_kernel_ordered<T>(v2) & reduce_kernel_ordered<T>(v3);
+        reg min0 = v0, min1 = v1, min2 = v2, min3 = v3;
+        reg max0 = v0, max1 = v1, max2 = v2, max3 = v3;
+        for(i = 4 * lanes; i + 4 * lanes <= n; i += 4 * lanes){
+            v0 = traits::load(first + i);
+            v1 = traits::load(first + i + lanes);
+            v2 = traits::load(first + i + 2 * lanes);
+            v3 = traits::load(first + i + 3 * lanes);
+            ordered &= reduce_kernel_ordered<T>(v0) & reduce_kernel_ordered<T>(v1) & reduce_kernel_ordered<T>(v2) & reduce_kernel_ordered<T>(v3);
+            if constexpr(Min){
+                min0 = traits::min(min0, v0);
+                min1 = traits::min(min1, v1);
+                min2 = traits::min(min2, v2);
+                min3 = traits::min(min3, v3);
+            }
+            if constexpr(Max){
+                max0 = traits::max(max0, v0);
+                max1 = traits::max(max1, v1);
+                max2 = traits::max(max2, v2);
+                max3 = traits::max(max3, v3);
+            }
+        }
+        for(; i + lanes <= n; i += lanes){
+            v0 = traits::load(first + i);
+            ordered &= reduce_kernel_ordered<T>(v0);
+            if constexpr(Min){
+                min0 = traits::min(min0, v0);
+            }
+            if constexpr(Max){
+                max0 = traits::max(max0, v0);
+            }
+        }
+        if(ordered != all){
+            return false;
+        }
+        alignas(64) T lane[lanes];
+        if constexpr(Min){
+            traits::store(lane, traits::min(traits::min(min0, min1), traits::min(min2, min3)));
+            min = lane[0];
+            for(std::size_t j = 1; j < lanes; ++j){
+                min = lane[j] < min ? lane[j] : min;
+            }
+        }
+        if constexpr(Max){
+            traits::store(lane, traits::max(traits::max(max0, max1), traits::max(max2, max3)));
+            max = lane[0];
+            for(std::size_t j = 1; j < lanes; ++j){
+                max = max < lane[j] ? lane[j] : max;
+            }
+        }
+    }
+    for(; i < n; ++i){
+        T x = first[i];
+        if(x != x){
+            return false;
+        }
+        min = x < min ? x : min;
+        max = max < x ? x : max;
+    }
+    return true;
+}
+
+// index of the first element of [first, first + n) equal to value, which is its minimum (Max false) or maximum
+template<bool Max, typename T>
+inline std::size_t find_extremum(const T* first, std::size_t n, T value)
+{
+    using traits = vector_traits<T>;
+    using reg = typename traits::reg;
+    constexpr std::size_t lanes = traits::lanes;
+    reg target = traits::set1(value);
+    std::size_t i = 0;
+    for(; i + lanes <= n; i += lanes){
+        reg v = traits::load(first + i);
+        unsigned mask = Max ? traits::greater_equal_mask(v, target) : traits::greater_equal_mask(target, v);
+        if(mask != 0){
+            return i + static_cast<std::size_t>(__builtin_ctz(mask));
+        }
+    }
+    while(Max ? first[i] < value : value < first[i]){
+        ++i;
+    }
+    return i;
+}
+
+// index of the first minimum of [first, first + n), n > 0, or n
+template<typename T>
+std::size_t min_element(const T* first, std::size_t n)
+{
+    std::size_t best_block = 0;
+    T best = first[0];
+    for(std::size_t block = 0; block < n; block += reduce_kernel_block){
+        std::size_t size = std::min<std::size_t>(reduce_kernel_block, n - block);
+        T min, max;
+        if(!reduce_block<true, false>(first + block, size, min, max)){
+            return n;
+        }
+        if(min < best){
+            best = min;
+            best_block = block;
+        }
+    }
+    return best_block + find_extremum<false>(first + best_block, std::min<std::size_t>(reduce_kernel_block, n - best_block), best);
+}
+
+// index of the first maximum of [first, first + n), n > 0, or n
+template<typename T>
+std::size_t max_element(const T* first, std::size_t n)
+{
+    std::size_t best_block = 0;
+    T best = first[0];
+    for(std::size_t block = 0; block < n; block += reduce_kernel_block){
+        std::size_t size = std::min<std::size_t>(reduce_kernel_block, n - block);
+        T min, max;
+        if(!reduce_block<false, true>(first + block, size, min, max)){
+            return n;
+        }
+        if(best < max){
+            best = max;
+            best_block = block;
+        }
+    }
+    return best_block + find_extremum<true>(first + best_block, std::min<std::size_t>(reduce_kernel_block, n - best_block), best);
+}
+
+// indices of the first minimum and the first maximum of [first, first + n), n > 0, or both n
+template<typename T>
+std::pair<std::size_t, std::size_t> minmax_element(const T* first, std::size_t n)
+{
+    std::size_t min_block = 0;
+    std::size_t max_block = 0;
+    T min_best = first[0];
+    T max_best = first[0];
+    for(std::size_t block = 0; block < n; block += reduce_kernel_block){
+        std::size_t size = std::min<std::size_t>(reduce_kernel_block, n - block);
+        T min, max;
+        if(!reduce_block<true, true>(first + block, size, min, max)){
+            return std::make_pair(n, n);
+        }
+        if(min < min_best){
+            min_best = min;
+            min_block = block;
+        }
+        if(max_best < max){
+            max_best = max;
+            max_block = block;
+        }
+    }
+    return std::make_pair(min_block + find_extremum<false>(first + min_block, std::min<std::size_t>(reduce_kernel_block, n - min_block), min_best),
+                          max_block + find_extremum<true>(first + max_block, std::min<std::size_t>(reduce_kernel_block, n - max_block), max_best));
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+// Node search of rtw::static_btree, written once against vector_traits<T> and included by each instruction set header
+// inside its own namespace and target region (no include guard on purpose).
+//
+// vector_traits<T> provides, for a register reg of lanes elements:
+//   set1, load and greater_equal_mask(a, b) as a lane bit mask.
+//
+// A node is compared with the value a register at a time and the lanes counted from the mask, so a search costs one
+// dependent load and a handful of instructions per level and never branches on the keys. NaN keys are not supported.
+
+// the number of the B keys of a node that are less than value (Upper false) or not greater than it (Upper true)
+template<bool Upper, std::size_t B, typename T>
+inline std::size_t btree_node_rank(const T* keys, T value)
+{
+    using traits = vector_traits<T>;
+    using reg = typename traits::reg;
+    constexpr std::size_t lanes = traits::lanes;
+    static_assert(B % lanes == 0, "a node must fill whole registers");
+    reg target = traits::set1(value);
+    std::size_t count = 0;
+    for(std::size_t i = 0; i < B; i += lanes){
+        reg v = traits::load(keys + i);
+        unsigned mask = Upper ? traits::greater_equal_mask(target, v) : traits::greater_equal_mask(v, target);
+        count += static_cast<std::size_t>(__builtin_popcount(mask));
+    }
+    return Upper ? count : B - count;
+}
+
+// the leaf rank a static_btree search ends at: nodes holds the layers root first, offsets[h] being the first node of
+// layer h and counts[h] its number of nodes; a child beyond the layer only holds the padding and is taken as its last node
+template<bool Upper, std::size_t B, typename Node, typename T>
+inline std::size_t btree_search(const Node* nodes, const std::size_t* offsets, const std::size_t* counts, std::size_t height, T value)
+{
+    std::size_t k = 0;
+    for(std::size_t h = 0; h + 1 < height; ++h){
+        std::size_t child = k * (B + 1) + btree_node_rank<Upper, B>(nodes[offsets[h] + k].keys, value);
+        k = child < counts[h + 1] ? child : counts[h + 1] - 1;
+    }
+    return k * B + btree_node_rank<Upper, B>(nodes[offsets[height - 1] + k].keys, value);
+}
\ No newline at end of file
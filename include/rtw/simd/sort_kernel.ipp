@@ -0,0 +1,287 @@
+// Vectorized sort and selection, written once against vector_traits<T> and included by each
+// instruction set header inside its own namespace and target region (no include guard on purpose).
+//
+// vector_traits<T> provides, for a register reg of lanes elements:
+//   set1, load, store, load_partial(p, n, fill), store_partial(p, n, v), min, max,
+//   greater_mask(a, b) and greater_equal_mask(a, b) as lane bit masks,
+//   swap_lanes(v, j) exchanging every lane with lane ^ j, blend(a, b, mask) taking b where mask is set,
+//   partition_store(left, right_end, v, mask) writing the lanes outside mask from left onwards and
+//   the lanes in mask just below right_end; it may clobber lanes elements on both sides.
+
+// leaves of at most sort_kernel_registers registers are finished by the in-register bitonic sort
+enum { sort_kernel_registers = 8, sort_kernel_ninther_threshold = 1024 };
+
+template<typename T>
+inline T sort_kernel_padding()
+{
+    if constexpr(std::is_floating_point<T>::value){
+        return std::numeric_limits<T>::infinity();
+    }
+    else{
+        return std::numeric_limits<T>::max();
+    }
+}
+
+// lanes whose index has bit b set, b being a power of two below 16
+inline unsigned lane_bits(int b)
+{
+    switch(b){
+    case 1: return 0xAAAAu;
+    case 2: return 0xCCCCu;
+    case 4: return 0xF0F0u;
+    default: return 0xFF00u;
+    }
+}
+
+// bitonic sort over R registers seen as one array of R * lanes elements, register i holding [i * lanes, (i + 1) * lanes)
+template<typename T, int R>
+inline void bitonic_sort_registers(typename vector_traits<T>::reg* r)
+{
+    using traits = vector_traits<T>;
+    using reg = typename traits::reg;
+    constexpr int lanes = traits::lanes;
+    constexpr unsigned full = (1u << lanes) - 1;
+    for(int k = 2; k <= R * lanes; k *= 2){
+        for(int j = k / 2; j > 0; j /= 2){
+            if(j >= lanes){
+                // the partner is another register and the direction is the same for the whole register
+                int jr = j / lanes;
+                for(int i = 0; i < R; ++i){
+                    if((i & jr) == 0 && (i | jr) < R){
+                        reg low = traits::min(r[i], r[i | jr]);
+                        reg high = traits::max(r[i], r[i | jr]);
+                        bool ascending = ((i * lanes) & k) == 0;
+                        r[i] = ascending ? low : high;
+                        r[i | jr] = ascending ? high : low;
+                    }
+                }
+            }
+            else{
+                for(int i = 0; i < R; ++i){
+                    unsigned descending = k >= lanes ? (((i * lanes) & k) ? full : 0u) : (lane_bits(k) & full);
+                    unsigned take_max = (lane_bits(j) & full) ^ descending;
+                    reg swapped = traits::swap_lanes(r[i], j);
+                    r[i] = traits::blend(traits::min(r[i], swapped), traits::max(r[i], swapped), take_max);
+                }
+            }
+        }
+    }
+}
+
+template<typename T, int R>
+inline void bitonic_sort_block(T* p, std::size_t n)
+{
+    using traits = vector_traits<T>;
+    using reg = typename traits::reg;
+    constexpr int lanes = traits::lanes;
+    reg fill = traits::set1(sort_kernel_padding<T>());
+    reg r[R];
+    for(int i = 0; i < R; ++i){
+        std::ptrdiff_t count = std::min<std::ptrdiff_t>(std::max<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(n) - i * lanes, 0), lanes);
+        r[i] = count == lanes ? traits::load(p + i * lanes) : traits::load_partial(p + i * lanes, static_cast<int>(count), fill);
+    }
+    bitonic_sort_registers<T, R>(r);
+    for(int i = 0; i < R; ++i){
+        std::ptrdiff_t count = std::min<std::ptrdiff_t>(std::max<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(n) - i * lanes, 0), lanes);
+        if(count == lanes){
+            traits::store(p + i * lanes, r[i]);
+        }
+        else if(count > 0){
+            traits::store_partial(p + i * lanes, static_cast<int>(count), r[i]);
+        }
+    }
+}
+
+// sorts at most sort_kernel_registers * lanes elements, the missing lanes are padded with the largest value
+template<typename T>
+inline void small_sort(T* p, std::size_t n)
+{
+    constexpr std::size_t lanes = vector_traits<T>::lanes;
+    if(n < 2){
+        return;
+    }
+    if(n <= lanes){
+        bitonic_sort_block<T, 1>(p, n);
+    }
+    else if(n <= 2 * lanes){
+        bitonic_sort_block<T, 2>(p, n);
+    }
+    else if(n <= 4 * lanes){
+        bitonic_sort_block<T, 4>(p, n);
+    }
+    else{
+        bitonic_sort_block<T, 8>(p, n);
+    }
+}
+
+template<typename T, bool OrEqual>
+inline bool goes_right(T x, T pivot)
+{
+    return OrEqual ? x > pivot : x >= pivot;
+}
+
+// partitions [p, p + n) into elements less than the pivot (not greater when OrEqual) followed by the others,
+// returns the size of the left part; the first and last registers are held back so that there is always
+// one register of free space on both sides to store into
+template<typename T, bool OrEqual>
+std::size_t partition(T* p, std::size_t n, T pivot)
+{
+    using traits = vector_traits<T>;
+    using reg = typename traits::reg;
+    constexpr std::size_t lanes = traits::lanes;
+    if(n < 2 * lanes){
+        T* left = p;
+        for(T* it = p; it != p + n; ++it){
+            if(!goes_right<T, OrEqual>(*it, pivot)){
+                std::iter_swap(left, it);
+                ++left;
+            }
+        }
+        return left - p;
+    }
+
+    reg pivot_vector = traits::set1(pivot);
+    reg first_vector = traits::load(p);
+    reg last_vector = traits::load(p + n - lanes);
+    std::size_t left_read = lanes;
+    std::size_t right_read = n - lanes;
+    std::size_t left_store = 0;
+    std::size_t right_store = n;
+    while(right_read - left_read >= lanes){
+        // read from the side with less free space so that both keep at least one register of it
+        reg v;
+        if(left_read - left_store <= right_store - right_read){
+            v = traits::load(p + left_read);
+            left_read += lanes;
+        }
+        else{
+            right_read -= lanes;
+            v = traits::load(p + right_read);
+        }
+        unsigned mask = OrEqual ? traits::greater_mask(v, pivot_vector) : traits::greater_equal_mask(v, pivot_vector);
+        std::size_t count = __builtin_popcount(mask);
+        traits::partition_store(p + left_store, p + right_store, v, mask);
+        left_store += lanes - count;
+        right_store -= count;
+    }
+
+    // the unread tail and the two held back registers fill the remaining gap exactly
+    T rest[3 * lanes];
+    std::size_t size = right_read - left_read;
+    std::copy(p + left_read, p + right_read, rest);
+    traits::store(rest + size, first_vector);
+    traits::store(rest + size + lanes, last_vector);
+    for(std::size_t i = 0; i < size + 2 * lanes; ++i){
+        if(goes_right<T, OrEqual>(rest[i], pivot)){
+            p[--right_store] = rest[i];
+        }
+        else{
+            p[left_store++] = rest[i];
+        }
+    }
+    return left_store;
+}
+
+template<typename T>
+inline T median_of_three(T a, T b, T c)
+{
+    return std::max(std::min(a, b), std::min(std::max(a, b), c));
+}
+
+template<typename T>
+inline T choose_pivot(const T* p, std::size_t n)
+{
+    std::size_t half = n / 2;
+    if(n > sort_kernel_ninther_threshold){
+        std::size_t eighth = n / 8;
+        return median_of_three(
+            median_of_three(p[0], p[eighth], p[2 * eighth]),
+            median_of_three(p[half - eighth], p[half], p[half + eighth]),
+            median_of_three(p[n - 1 - 2 * eighth], p[n - 1 - eighth], p[n - 1]));
+    }
+    return median_of_three(p[0], p[half], p[n - 1]);
+}
+
+inline int depth_limit(std::size_t n)
+{
+    int log = 0;
+    while(n >>= 1){
+        ++log;
+    }
+    return 2 * log;
+}
+
+template<typename T>
+void sort_loop(T* p, std::size_t n, int depth)
+{
+    constexpr std::size_t small = sort_kernel_registers * vector_traits<T>::lanes;
+    while(n > small){
+        if(depth == 0){
+            rtw::make_heap(p, p + n, std::less<T>());
+            rtw::sort_heap(p, p + n, std::less<T>());
+            return;
+        }
+        --depth;
+        T pivot = choose_pivot(p, n);
+        std::size_t middle = partition<T, false>(p, n, pivot);
+        if(middle == 0){
+            // the pivot is the smallest element, everything equal to it is gathered on the left and done
+            middle = partition<T, true>(p, n, pivot);
+            p += middle;
+            n -= middle;
+            continue;
+        }
+        if(middle < n - middle){
+            sort_loop(p, middle, depth);
+            p += middle;
+            n -= middle;
+        }
+        else{
+            sort_loop(p + middle, n - middle, depth);
+            n = middle;
+        }
+    }
+    small_sort(p, n);
+}
+
+template<typename T>
+void sort(T* p, std::size_t n)
+{
+    sort_loop(p, n, depth_limit(n));
+}
+
+// places the k-th smallest element at p[k], smaller ones before and larger ones after it
+template<typename T>
+void nth_element(T* p, std::size_t n, std::size_t k)
+{
+    constexpr std::size_t small = sort_kernel_registers * vector_traits<T>::lanes;
+    int depth = depth_limit(n);
+    while(n > small){
+        if(depth == 0){
+            sort_loop(p, n, depth_limit(n));
+            return;
+        }
+        --depth;
+        T pivot = choose_pivot(p, n);
+        std::size_t middle = partition<T, false>(p, n, pivot);
+        if(middle == 0){
+            middle = partition<T, true>(p, n, pivot);
+            if(k < middle){
+                return;
+            }
+            p += middle;
+            n -= middle;
+            k -= middle;
+            continue;
+        }
+        if(k < middle){
+            n = middle;
+        }
+        else{
+            p += middle;
+            n -= middle;
+            k -= middle;
+        }
+    }
+    small_sort(p, n);
+}
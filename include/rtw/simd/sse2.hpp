@@ -0,0 +1,134 @@
+#ifndef RTW_SIMD_SSE2_HPP
+#define RTW_SIMD_SSE2_HPP
+
+#include <rtw/simd/isa.hpp>
+
+#if defined(RTW_SIMD_X86)
+
+#include <emmintrin.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// SSE2 is part of x86-64, so unlike the other instruction sets it needs no target region;
+// only the reductions and the node search of static_btree are provided at this level
+namespace rtw{
+namespace sse2{
+
+template<typename T>
+struct vector_traits;
+
+// 32-bit integers; SSE2 has neither their min and max nor unsigned comparisons, so both are built from the signed
+// comparison, after flipping the sign bit for unsigned ones
+template<typename T>
+struct vector_traits_int32{
+    using reg = __m128i;
+    static constexpr int lanes = 4;
+
+    static reg set1(T x){
+        return _mm_set1_epi32(static_cast<int>(x));
+    }
+    static reg load(const T* p){
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+    static void store(T* p, reg v){
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+    }
+    static reg greater(reg a, reg b){
+        if(!std::is_signed<T>::value){
+            __m128i sign = _mm_set1_epi32(std::numeric_limits<int>::min());
+            a = _mm_xor_si128(a, sign);
+            b = _mm_xor_si128(b, sign);
+        }
+        return _mm_cmpgt_epi32(a, b);
+    }
+    static reg min(reg a, reg b){
+        reg mask = greater(a, b);
+        return _mm_or_si128(_mm_and_si128(mask, b), _mm_andnot_si128(mask, a));
+    }
+    static reg max(reg a, reg b){
+        reg mask = greater(a, b);
+        return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    }
+    static unsigned greater_equal_mask(reg a, reg b){
+        return ~static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(greater(b, a)))) & 0xFu;
+    }
+};
+
+template<>
+struct vector_traits<std::int32_t> : vector_traits_int32<std::int32_t>{};
+
+template<>
+struct vector_traits<std::uint32_t> : vector_traits_int32<std::uint32_t>{};
+
+template<>
+struct vector_traits<float>{
+    using T = float;
+    using reg = __m128;
+    static constexpr int lanes = 4;
+
+    static reg set1(T x){
+        return _mm_set1_ps(x);
+    }
+    static reg load(const T* p){
+        return _mm_loadu_ps(p);
+    }
+    static void store(T* p, reg v){
+        _mm_storeu_ps(p, v);
+    }
+    static reg min(reg a, reg b){
+        return _mm_min_ps(a, b);
+    }
+    static reg max(reg a, reg b){
+        return _mm_max_ps(a, b);
+    }
+    static unsigned greater_equal_mask(reg a, reg b){
+        return static_cast<unsigned>(_mm_movemask_ps(_mm_cmpge_ps(a, b)));
+    }
+};
+
+template<>
+struct vector_traits<double>{
+    using T = double;
+    using reg = __m128d;
+    static constexpr int lanes = 2;
+
+    static reg set1(T x){
+        return _mm_set1_pd(x);
+    }
+    static reg load(const T* p){
+        return _mm_loadu_pd(p);
+    }
+    static void store(T* p, reg v){
+        _mm_storeu_pd(p, v);
+    }
+    static reg min(reg a, reg b){
+        return _mm_min_pd(a, b);
+    }
+    static reg max(reg a, reg b){
+        return _mm_max_pd(a, b);
+    }
+    static unsigned greater_equal_mask(reg a, reg b){
+        return static_cast<unsigned>(_mm_movemask_pd(_mm_cmpge_pd(a, b)));
+    }
+};
+
+// the types with vector_traits at this level, 64-bit integers needing the comparisons of SSE4.2
+template<typename T>
+struct has_vector_traits : std::integral_constant<bool,
+    std::is_same<T, std::int32_t>::value || std::is_same<T, std::uint32_t>::value ||
+    std::is_same<T, float>::value || std::is_same<T, double>::value>{};
+
+#include <rtw/simd/reduce_kernel.ipp>
+#include <rtw/simd/search_kernel.ipp>
+
+} // namespace sse2
+} // namespace rtw
+
+#endif // RTW_SIMD_X86
+
+#endif // RTW_SIMD_SSE2_HPP
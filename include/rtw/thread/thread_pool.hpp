@@ -0,0 +1,172 @@
+#ifndef RTW_THREAD_POOL_HPP
+#define RTW_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace rtw{
+
+class thread_pool{
+private:
+    std::vector<std::thread> threads_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stopped_;
+public:
+    // constructor
+    explicit thread_pool(std::size_t thread_count = std::thread::hardware_concurrency())
+    : threads_()
+    , tasks_()
+    , mutex_()
+    , condition_()
+    , stopped_(false){
+        if(thread_count == 0){
+            thread_count = 1;
+        }
+        threads_.reserve(thread_count);
+        for(std::size_t i = 0; i < thread_count; ++i){
+            threads_.emplace_back([this]() -> void { worker_loop(); });
+        }
+    }
+
+    thread_pool(const thread_pool& other) = delete;
+    thread_pool(thread_pool&& other) = delete;
+
+    // operator=
+    thread_pool& operator=(const thread_pool& other) = delete;
+    thread_pool& operator=(thread_pool&& other) = delete;
+
+    // destructor
+    ~thread_pool(){
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopped_ = true;
+        }
+        condition_.notify_all();
+        for(std::thread& thread : threads_){
+            thread.join();
+        }
+    }
+public:
+    std::size_t size() const noexcept{
+        return threads_.size();
+    }
+    template<typename Function>
+    void submit(Function&& function){
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.emplace_back(std::forward<Function>(function));
+        }
+        condition_.notify_one();
+    }
+    // runs the most recently submitted task on the calling thread, so that a waiting thread helps instead of blocking
+    bool run_pending_task(){
+        std::function<void()> task;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if(tasks_.empty()){
+                return false;
+            }
+            task = std::move(tasks_.back());
+            tasks_.pop_back();
+        }
+        task();
+        return true;
+    }
+private:
+    void worker_loop(){
+        while(true){
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                condition_.wait(lock, [this]() -> bool { return stopped_ || !tasks_.empty(); });
+                if(tasks_.empty()){
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+};
+
+class task_group{
+private:
+    rtw::thread_pool& pool_;
+    std::atomic<std::size_t> pending_;
+    std::mutex mutex_;
+    std::exception_ptr exception_;
+public:
+    // constructor
+    explicit task_group(rtw::thread_pool& pool)
+    : pool_(pool)
+    , pending_(0)
+    , mutex_()
+    , exception_(){}
+
+    task_group(const task_group& other) = delete;
+    task_group(task_group&& other) = delete;
+
+    // operator=
+    task_group& operator=(const task_group& other) = delete;
+    task_group& operator=(task_group&& other) = delete;
+
+    // destructor
+    ~task_group(){
+        wait_pending();
+    }
+public:
+    rtw::thread_pool& pool() const noexcept{
+        return pool_;
+    }
+    template<typename Function>
+    void run(Function&& function){
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        pool_.submit([this, function = std::forward<Function>(function)]() mutable -> void {
+            try{
+                function();
+            }
+            catch(...){
+                std::lock_guard<std::mutex> lock(mutex_);
+                if(!exception_){
+                    exception_ = std::current_exception();
+                }
+            }
+            pending_.fetch_sub(1, std::memory_order_acq_rel);
+        });
+    }
+    // waits for every task of this group, including tasks run by other tasks, and rethrows the first exception
+    void wait(){
+        wait_pending();
+        std::exception_ptr exception;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::swap(exception, exception_);
+        }
+        if(exception){
+            std::rethrow_exception(exception);
+        }
+    }
+private:
+    void wait_pending(){
+        while(pending_.load(std::memory_order_acquire) != 0){
+            if(!pool_.run_pending_task()){
+                std::this_thread::yield();
+            }
+        }
+    }
+};
+
+} // namespace rtw
+
+#endif // RTW_THREAD_POOL_HPP
\ No newline at end of file
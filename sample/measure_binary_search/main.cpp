@@ -0,0 +1,7 @@
+extern void measure_binary_search();
+
+int main()
+{
+    measure_binary_search();
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include <rtw/algorithm/binary_search.hpp>
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <cstdint>
+
+const int query_count = 1 << 20;
+
+void measure_binary_search()
+{
+    // size array
+    std::vector<int> size_array;
+    for(int i = 10; i <= 26; i += 2){
+        size_array.push_back(std::pow(2, i));
+    }
+
+    std::vector<int> std_result;
+    std::vector<int> rtw_result;
+    for(int size : size_array){
+        // sorted keys and random queries
+        std::mt19937 mt(size);
+        std::vector<std::uint32_t> keys(size);
+        for(int i = 0; i < size; i++){
+            keys[i] = mt();
+        }
+        std::sort(keys.begin(), keys.end());
+        std::vector<std::uint32_t> queries(query_count);
+        for(auto& query : queries){
+            query = mt();
+        }
+
+        // std::lower_bound
+        std::size_t std_sum = 0;
+        auto start = std::chrono::system_clock::now();
+        for(std::uint32_t query : queries){
+            std_sum += std::lower_bound(keys.data(), keys.data() + size, query) - keys.data();
+        }
+        auto end = std::chrono::system_clock::now();
+        std_result.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+
+        // rtw::lower_bound
+        std::size_t rtw_sum = 0;
+        start = std::chrono::system_clock::now();
+        for(std::uint32_t query : queries){
+            rtw_sum += rtw::lower_bound(keys.data(), keys.data() + size, query) - keys.data();
+        }
+        end = std::chrono::system_clock::now();
+        rtw_result.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+        if(std_sum != rtw_sum){
+            std::cout << "mismatch at size " << size << std::endl;
+        }
+    }
+
+    // console out
+    for(std::size_t i = 0; i < size_array.size(); i++){
+        std::cout << "size: " << size_array[i] << ", " << query_count << " queries, std::lower_bound: " << std_result[i] << " us, rtw::lower_bound: " << rtw_result[i] << " us" << std::endl;
+    }
+
+    // file out
+    std::ofstream ofs("binary_search_result.csv");
+    if(ofs.is_open()){
+        ofs << "size,";
+        for(int size : size_array){
+            ofs << size << ",";
+        }
+        ofs << std::endl;
+        ofs << "std::lower_bound,";
+        for(int elapsed : std_result){
+            ofs << elapsed << ",";
+        }
+        ofs << std::endl;
+        ofs << "rtw::lower_bound,";
+        for(int elapsed : rtw_result){
+            ofs << elapsed << ",";
+        }
+        ofs << std::endl;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,7 @@
+extern void measure_eytzinger_index();
+
+int main()
+{
+    measure_eytzinger_index();
+    return 0;
+}
\ No newline at end of file
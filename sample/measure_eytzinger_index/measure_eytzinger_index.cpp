@@ -0,0 +1,85 @@
+#include <rtw/algorithm/binary_search.hpp>
+#include <rtw/algorithm/eytzinger_index.hpp>
+#include <rtw/container/vector.hpp>
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <cstdint>
+
+const int query_count = 1 << 20;
+
+void measure_eytzinger_index()
+{
+    // size array, from 4 KB (L1) to 1 GB of keys
+    std::vector<int> size_array;
+    for(int i = 10; i <= 28; i += 2){
+        size_array.push_back(std::pow(2, i));
+    }
+
+    std::vector<int> binary_result;
+    std::vector<int> eytzinger_result;
+    for(int size : size_array){
+        // sorted keys, generated in order, and random queries
+        std::mt19937 mt(size);
+        rtw::vector<std::uint32_t> keys(size);
+        for(int i = 0; i < size; i++){
+            keys[i] = static_cast<std::uint32_t>(i) * 8 + mt() % 8;
+        }
+        std::vector<std::uint32_t> queries(query_count);
+        for(auto& query : queries){
+            query = mt() % (static_cast<std::uint32_t>(size) * 8);
+        }
+        rtw::eytzinger_index<std::uint32_t> index(keys);
+
+        // rtw::lower_bound
+        std::size_t binary_sum = 0;
+        auto start = std::chrono::system_clock::now();
+        for(std::uint32_t query : queries){
+            binary_sum += rtw::lower_bound(keys.data(), keys.data() + size, query) - keys.data();
+        }
+        auto end = std::chrono::system_clock::now();
+        binary_result.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+
+        // rtw::eytzinger_index
+        std::size_t eytzinger_sum = 0;
+        start = std::chrono::system_clock::now();
+        for(std::uint32_t query : queries){
+            eytzinger_sum += index.lower_bound(query);
+        }
+        end = std::chrono::system_clock::now();
+        eytzinger_result.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+        if(binary_sum != eytzinger_sum){
+            std::cout << "mismatch at size " << size << std::endl;
+        }
+    }
+
+    // console out
+    for(std::size_t i = 0; i < size_array.size(); i++){
+        std::cout << "size: " << size_array[i] << ", " << query_count << " queries, rtw::lower_bound: " << binary_result[i] << " us, rtw::eytzinger_index: " << eytzinger_result[i] << " us" << std::endl;
+    }
+
+    // file out
+    std::ofstream ofs("eytzinger_index_result.csv");
+    if(ofs.is_open()){
+        ofs << "size,";
+        for(int size : size_array){
+            ofs << size << ",";
+        }
+        ofs << std::endl;
+        ofs << "rtw::lower_bound,";
+        for(int elapsed : binary_result){
+            ofs << elapsed << ",";
+        }
+        ofs << std::endl;
+        ofs << "rtw::eytzinger_index,";
+        for(int elapsed : eytzinger_result){
+            ofs << elapsed << ",";
+        }
+        ofs << std::endl;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,10 @@
+#include <cstdlib>
+
+extern void measure_heap(int max_exponent);
+
+// the largest queue measured holds 2^max_exponent elements, 2^25 by default
+int main(int argc, char* argv[])
+{
+    measure_heap(argc > 1 ? std::atoi(argv[1]) : 25);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include <rtw/container/priority_queue.hpp>
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <cstdint>
+#include <new>
+
+enum Arity{
+    BINARY = 0,
+    QUATERNARY = 1,
+    OCTONARY = 2,
+    SIZE
+};
+
+const std::vector<std::string> names{ "2-ary", "4-ary", "8-ary" };
+
+// nanoseconds per push while filling the queue with size random keys, and per pop while draining it
+template<std::size_t D>
+std::pair<double, double> measure(const std::vector<std::uint64_t>& keys)
+{
+    rtw::priority_queue<std::uint64_t, rtw::vector<std::uint64_t>, std::less<std::uint64_t>, D> queue;
+    auto start = std::chrono::steady_clock::now();
+    for(std::uint64_t key : keys){
+        queue.push(key);
+    }
+    auto middle = std::chrono::steady_clock::now();
+    std::uint64_t previous = ~std::uint64_t(0);
+    while(!queue.empty()){
+        if(previous < queue.top()){
+            std::cerr << "not ordered" << std::endl;
+        }
+        previous = queue.top();
+        queue.pop();
+    }
+    auto end = std::chrono::steady_clock::now();
+    double size = static_cast<double>(keys.size());
+    return std::make_pair(std::chrono::duration<double, std::nano>(middle - start).count() / size,
+                          std::chrono::duration<double, std::nano>(end - middle).count() / size);
+}
+
+void measure_heap(int max_exponent)
+{
+    // sizes from what fits into L1 to well beyond the last level cache
+    std::vector<long long> size_array;
+    for(int exponent = 10; exponent <= max_exponent; exponent += 3){
+        size_array.push_back(1LL << exponent);
+    }
+
+    // result
+    std::vector<std::vector<double>> push_result(Arity::SIZE);
+    std::vector<std::vector<double>> pop_result(Arity::SIZE);
+
+    std::vector<long long> measured;
+    for(long long size : size_array){
+        std::vector<std::uint64_t> keys;
+        try{
+            keys.resize(size);
+        }
+        catch(const std::bad_alloc&){
+            std::cout << "size: " << size << " does not fit in memory" << std::endl;
+            break;
+        }
+        std::mt19937_64 mt(size);
+        for(auto& key : keys){
+            key = mt();
+        }
+        measured.push_back(size);
+        std::pair<double, double> result[Arity::SIZE] = { measure<2>(keys), measure<4>(keys), measure<8>(keys) };
+        for(std::size_t arity = 0; arity < Arity::SIZE; arity++){
+            push_result[arity].push_back(result[arity].first);
+            pop_result[arity].push_back(result[arity].second);
+        }
+    }
+
+    // console out
+    for(std::size_t i = 0; i < measured.size(); i++){
+        std::cout << "size: " << measured[i];
+        for(std::size_t arity = 0; arity < Arity::SIZE; arity++){
+            std::cout << ", " << names[arity] << " push: " << push_result[arity][i] << " ns, pop: " << pop_result[arity][i] << " ns";
+        }
+        std::cout << std::endl;
+    }
+
+    // file out
+    std::ofstream ofs("heap_result.csv");
+    if(ofs.is_open()){
+        ofs << "size,";
+        for(long long size : measured){
+            ofs << size << ",";
+        }
+        ofs << std::endl;
+        for(std::size_t arity = 0; arity < Arity::SIZE; arity++){
+            ofs << names[arity] << " push,";
+            for(double elapsed : push_result[arity]){
+                ofs << elapsed << ",";
+            }
+            ofs << std::endl;
+            ofs << names[arity] << " pop,";
+            for(double elapsed : pop_result[arity]){
+                ofs << elapsed << ",";
+            }
+            ofs << std::endl;
+        }
+        ofs.close();
+    }
+}
\ No newline at end of file
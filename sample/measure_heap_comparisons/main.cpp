@@ -0,0 +1,10 @@
+#include <cstdlib>
+
+extern void measure_heap_comparisons(int max_exponent);
+
+// the largest size measured is 10^max_exponent, 10^6 by default
+int main(int argc, char* argv[])
+{
+    measure_heap_comparisons(argc > 1 ? std::atoi(argv[1]) : 6);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,158 @@
+#include <rtw/algorithm/heap.hpp>
+#include <rtw/algorithm/partial_sort.hpp>
+#include <rtw/container/priority_queue.hpp>
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <fstream>
+#include <string>
+
+enum HeapOperation{
+    SORT_HEAP_TOP_DOWN = 0,
+    SORT_HEAP_BOTTOM_UP = 1,
+    PARTIAL_SORT_TOP_DOWN = 2,
+    PARTIAL_SORT_BOTTOM_UP = 3,
+    PRIORITY_QUEUE_POP = 4,
+    SIZE
+};
+
+const std::vector<std::string> names{ "sort_heap top-down", "sort_heap bottom-up", "partial_sort top-down", "partial_sort bottom-up", "priority_queue pop" };
+
+// keys sharing a long prefix, so that every comparison is a heavyweight one
+inline std::vector<std::string> generate(long long size)
+{
+    std::mt19937_64 mt(size);
+    std::vector<std::string> keys(size);
+    for(auto& key : keys){
+        key = std::string(48, 'k') + std::to_string(mt());
+    }
+    return keys;
+}
+
+// pops sifting down from the root with two comparisons per level, as the heap algorithms did before bottom-up sifting
+template<typename RandomAccessIterator, typename Compare>
+void sort_heap_top_down(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    while(last - first > 1){
+        --last;
+        std::iter_swap(first, last);
+        rtw::adjust_heap(first, first, last, compare);
+    }
+}
+
+template<typename RandomAccessIterator, typename Compare>
+void partial_sort_top_down(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, Compare compare)
+{
+    rtw::make_heap(first, middle, compare);
+    for(RandomAccessIterator it = middle; it < last; ++it){
+        if(compare(*it, *first)){
+            std::iter_swap(it, first);
+            rtw::adjust_heap(first, first, middle, compare);
+        }
+    }
+    sort_heap_top_down(first, middle, compare);
+}
+
+// comparisons per element and milliseconds of one operation on what prepare builds from a fresh copy of the keys;
+// the comparisons of prepare are not counted
+template<typename Prepare, typename Operation>
+std::pair<double, long long> measure(const std::vector<std::string>& keys, Prepare prepare, Operation operation)
+{
+    std::vector<std::string> data(keys);
+    long long comparisons = 0;
+    auto compare = [&comparisons](const std::string& lhs, const std::string& rhs) -> bool {
+        ++comparisons;
+        return lhs < rhs;
+    };
+    auto prepared = prepare(data, compare);
+    comparisons = 0;
+    auto start = std::chrono::system_clock::now();
+    operation(prepared, compare);
+    auto end = std::chrono::system_clock::now();
+    return std::make_pair(static_cast<double>(comparisons) / keys.size(), std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+}
+
+// comparisons per element and milliseconds of one operation on a fresh copy of the keys
+template<typename Operation>
+std::pair<double, long long> measure(const std::vector<std::string>& keys, Operation operation)
+{
+    return measure(keys, [](auto& data, auto) -> std::vector<std::string>* {
+        return &data;
+    }, [&operation](auto data, auto compare) -> void {
+        operation(*data, compare);
+    });
+}
+
+void measure_heap_comparisons(int max_exponent)
+{
+    // size array
+    std::vector<long long> size_array;
+    for(long long size = 1000, exponent = 3; exponent <= max_exponent; size *= 10, ++exponent){
+        size_array.push_back(size);
+    }
+
+    // result
+    std::vector<std::vector<std::pair<double, long long>>> result(HeapOperation::SIZE);
+
+    for(long long size : size_array){
+        std::vector<std::string> keys = generate(size);
+        // the sorts start from the same heap, only the pops are compared
+        std::vector<std::string> heap(keys);
+        rtw::make_heap(heap.begin(), heap.end());
+        result[SORT_HEAP_TOP_DOWN].push_back(measure(heap, [](auto& data, auto compare) -> void {
+            sort_heap_top_down(data.begin(), data.end(), compare);
+        }));
+        result[SORT_HEAP_BOTTOM_UP].push_back(measure(heap, [](auto& data, auto compare) -> void {
+            rtw::sort_heap(data.begin(), data.end(), compare);
+        }));
+        result[PARTIAL_SORT_TOP_DOWN].push_back(measure(keys, [](auto& data, auto compare) -> void {
+            partial_sort_top_down(data.begin(), data.begin() + data.size() / 10, data.end(), compare);
+        }));
+        result[PARTIAL_SORT_BOTTOM_UP].push_back(measure(keys, [](auto& data, auto compare) -> void {
+            rtw::partial_sort(data.begin(), data.begin() + data.size() / 10, data.end(), compare);
+        }));
+        // the queue is built outside the count, its constructor making a heap of the heap again
+        result[PRIORITY_QUEUE_POP].push_back(measure(heap, [](auto& data, auto compare) {
+            return rtw::priority_queue<std::string, std::vector<std::string>, decltype(compare)>(compare, std::move(data));
+        }, [](auto& queue, auto) -> void {
+            while(!queue.empty()){
+                queue.pop();
+            }
+        }));
+    }
+
+    // console out
+    for(std::size_t i = 0; i < size_array.size(); i++){
+        std::cout << "size: " << size_array[i];
+        for(std::size_t operation = 0; operation < HeapOperation::SIZE; operation++){
+            std::cout << ", " << names[operation] << ": " << result[operation][i].first << " comparisons/element " << result[operation][i].second << " ms";
+        }
+        std::cout << std::endl;
+    }
+
+    // file out
+    std::ofstream ofs("heap_comparisons_result.csv");
+    if(ofs.is_open()){
+        ofs << "size,";
+        for(long long size : size_array){
+            ofs << size << ",";
+        }
+        ofs << std::endl;
+        for(std::size_t operation = 0; operation < HeapOperation::SIZE; operation++){
+            ofs << names[operation] << " comparisons/element,";
+            for(const auto& measured : result[operation]){
+                ofs << measured.first << ",";
+            }
+            ofs << std::endl;
+            ofs << names[operation] << " ms,";
+            for(const auto& measured : result[operation]){
+                ofs << measured.second << ",";
+            }
+            ofs << std::endl;
+        }
+        ofs.close();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,7 @@
+extern void measure_minmax_element();
+
+int main()
+{
+    measure_minmax_element();
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include <rtw/algorithm/order_statistic.hpp>
+#include <rtw/simd/isa.hpp>
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <fstream>
+#include <string>
+
+const std::vector<rtw::simd_isa> isa_array{ rtw::simd_isa::scalar, rtw::simd_isa::sse2, rtw::simd_isa::avx2, rtw::simd_isa::avx512 };
+const std::vector<std::string> names{ "scalar", "sse2", "avx2", "avx512" };
+
+template<typename T>
+void measure(const std::string& type, const std::vector<int>& size_array, std::ofstream& ofs)
+{
+    for(std::size_t isa = 0; isa < isa_array.size(); isa++){
+        if(static_cast<int>(isa_array[isa]) > static_cast<int>(rtw::detect_simd_isa())){
+            continue;
+        }
+        rtw::set_simd_isa(isa_array[isa]);
+        std::vector<int> min_result;
+        std::vector<int> minmax_result;
+        for(int size : size_array){
+            // generate random data
+            std::mt19937_64 mt(size);
+            std::vector<T> data(size);
+            for(int i = 0; i < size; i++){
+                data[i] = static_cast<T>(mt());
+            }
+
+            // min element
+            auto start = std::chrono::system_clock::now();
+            const T* min = rtw::min_element(data.data(), data.data() + size);
+            auto end = std::chrono::system_clock::now();
+            min_result.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+
+            // minmax element
+            start = std::chrono::system_clock::now();
+            auto minmax = rtw::minmax_element(data.data(), data.data() + size);
+            end = std::chrono::system_clock::now();
+            minmax_result.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+            if(min != minmax.first){
+                std::cout << "mismatch at size " << size << std::endl;
+            }
+        }
+
+        // console out, with the bandwidth of the scans
+        for(std::size_t i = 0; i < size_array.size(); i++){
+            double bytes = static_cast<double>(size_array[i]) * sizeof(T);
+            std::cout << type << ", " << names[isa] << ", size: " << size_array[i]
+                      << ", min_element: " << min_result[i] << " us (" << bytes / std::max(min_result[i], 1) / 1e3 << " GB/s)"
+                      << ", minmax_element: " << minmax_result[i] << " us (" << bytes / std::max(minmax_result[i], 1) / 1e3 << " GB/s)" << std::endl;
+        }
+
+        // file out
+        if(ofs.is_open()){
+            ofs << type << " min_element " << names[isa] << ",";
+            for(int elapsed : min_result){
+                ofs << elapsed << ",";
+            }
+            ofs << std::endl;
+            ofs << type << " minmax_element " << names[isa] << ",";
+            for(int elapsed : minmax_result){
+                ofs << elapsed << ",";
+            }
+            ofs << std::endl;
+        }
+    }
+    rtw::set_simd_isa(rtw::detect_simd_isa());
+}
+
+void measure_minmax_element()
+{
+    // size array
+    std::vector<int> size_array;
+    for(int i = 10; i <= 24; i += 2){
+        size_array.push_back(std::pow(2, i));
+    }
+
+    std::ofstream ofs("minmax_element_result.csv");
+    if(ofs.is_open()){
+        ofs << "size,";
+        for(int size : size_array){
+            ofs << size << ",";
+        }
+        ofs << std::endl;
+    }
+
+    measure<std::int32_t>("int32", size_array, ofs);
+    measure<std::uint32_t>("uint32", size_array, ofs);
+    measure<std::int64_t>("int64", size_array, ofs);
+    measure<float>("float", size_array, ofs);
+    measure<double>("double", size_array, ofs);
+}
\ No newline at end of file
@@ -0,0 +1,7 @@
+extern void measure_parallel_sort();
+
+int main()
+{
+    measure_parallel_sort();
+    return 0;
+}
@@ -0,0 +1,114 @@
+#include <rtw/algorithm/intro_sort.hpp>
+#include <rtw/algorithm/merge_sort.hpp>
+#include <rtw/algorithm/parallel_merge_sort.hpp>
+#include <rtw/algorithm/parallel_sort.hpp>
+#include <rtw/thread/thread_pool.hpp>
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <fstream>
+#include <string>
+
+enum SortingAlgorithm{
+    INTRO_SORT = 0,
+    PARALLEL_SORT = 1,
+    MERGE_SORT = 2,
+    PARALLEL_MERGE_SORT = 3,
+    SIZE
+};
+
+const std::vector<std::string> names{ "intro_sort", "parallel_sort", "merge_sort", "parallel_merge_sort" };
+
+inline void pre_sort(const std::vector<int>& original, std::vector<int>& data, std::chrono::system_clock::time_point& start)
+{
+    std::copy(original.begin(), original.end(), data.begin());
+    start = std::chrono::system_clock::now();
+}
+
+inline void post_sort(const std::chrono::system_clock::time_point& start, std::chrono::system_clock::time_point& end, std::vector<std::vector<int>>& result, SortingAlgorithm algorithm)
+{
+    end = std::chrono::system_clock::now();
+    int elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    result[algorithm].push_back(elapsed);
+}
+
+void measure_parallel_sort()
+{
+    // size array
+    std::vector<int> size_array;
+    for(int i = 16; i <= 26; i += 2){
+        size_array.push_back(std::pow(2, i));
+    }
+
+    // result
+    std::vector<std::vector<int>> result(SortingAlgorithm::SIZE);
+
+    // the pool is shared by every measurement so that thread start-up is not measured
+    rtw::thread_pool pool;
+
+    // sort
+    for(int size : size_array){
+        // generate random data
+        std::random_device rnd;
+        std::mt19937 mt(rnd());
+        std::vector<int> original(size);
+        for(int i = 0; i < size; i++){
+            original[i] = mt();
+        }
+        std::vector<int> data(size);
+
+        // timer
+        std::chrono::system_clock::time_point start, end;
+
+        // intro sort
+        pre_sort(original, data, start);
+        rtw::intro_sort(data.begin(), data.end());
+        post_sort(start, end, result, SortingAlgorithm::INTRO_SORT);
+
+        // parallel sort
+        pre_sort(original, data, start);
+        rtw::parallel_sort(pool, data.begin(), data.end());
+        post_sort(start, end, result, SortingAlgorithm::PARALLEL_SORT);
+
+        // merge sort
+        pre_sort(original, data, start);
+        rtw::merge_sort(data.begin(), data.end());
+        post_sort(start, end, result, SortingAlgorithm::MERGE_SORT);
+
+        // parallel merge sort
+        pre_sort(original, data, start);
+        rtw::parallel_merge_sort(pool, data.begin(), data.end());
+        post_sort(start, end, result, SortingAlgorithm::PARALLEL_MERGE_SORT);
+    }
+
+    // console out
+    std::cout << "threads: " << pool.size() << std::endl;
+    for(std::size_t i = 0; i < size_array.size(); i++){
+        double speedup = static_cast<double>(result[INTRO_SORT][i]) / std::max(result[PARALLEL_SORT][i], 1);
+        std::cout << "size: " << size_array[i] << ", intro_sort: " << result[INTRO_SORT][i] << " us, parallel_sort: " << result[PARALLEL_SORT][i] << " us, speedup: " << speedup << std::endl;
+        double merge_speedup = static_cast<double>(result[MERGE_SORT][i]) / std::max(result[PARALLEL_MERGE_SORT][i], 1);
+        std::cout << "size: " << size_array[i] << ", merge_sort: " << result[MERGE_SORT][i] << " us, parallel_merge_sort: " << result[PARALLEL_MERGE_SORT][i] << " us, speedup: " << merge_speedup << std::endl;
+    }
+
+    // file out
+    std::ofstream ofs("parallel_sort_result.csv");
+    if(ofs.is_open()){
+        ofs << "size,";
+        for(int size : size_array){
+            ofs << size << ",";
+        }
+        ofs << std::endl;
+        for(auto data = result.begin(); data != result.end(); ++data){
+            ofs << names[std::distance(result.begin(), data)] << ",";
+            for(int elapsed : *data){
+                ofs << elapsed << ",";
+            }
+            ofs << std::endl;
+        }
+        ofs.close();
+    }
+}
\ No newline at end of file
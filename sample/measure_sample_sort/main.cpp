@@ -0,0 +1,10 @@
+#include <cstdlib>
+
+extern void measure_sample_sort(int max_exponent);
+
+// the largest size measured is 10^max_exponent, 10^9 by default
+int main(int argc, char* argv[])
+{
+    measure_sample_sort(argc > 1 ? std::atoi(argv[1]) : 9);
+    return 0;
+}
\ No newline at end of file
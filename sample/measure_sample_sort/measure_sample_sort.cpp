@@ -0,0 +1,114 @@
+#include <rtw/algorithm/intro_sort.hpp>
+#include <rtw/algorithm/parallel_sort.hpp>
+#include <rtw/algorithm/sample_sort.hpp>
+#include <rtw/thread/thread_pool.hpp>
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <cstdint>
+#include <new>
+
+enum SortingAlgorithm{
+    INTRO_SORT = 0,
+    PARALLEL_SORT = 1,
+    SAMPLE_SORT = 2,
+    PARALLEL_SAMPLE_SORT = 3,
+    SIZE
+};
+
+const std::vector<std::string> names{ "intro_sort", "parallel_sort", "sample_sort", "parallel_sample_sort" };
+
+// the data is generated again for every algorithm so that only one array of the largest size is needed
+inline void generate(std::vector<std::uint64_t>& data)
+{
+    std::mt19937_64 mt(data.size());
+    for(auto& x : data){
+        x = mt();
+    }
+}
+
+template<typename Sort>
+long long measure(std::vector<std::uint64_t>& data, Sort sort)
+{
+    generate(data);
+    auto start = std::chrono::system_clock::now();
+    sort(data.begin(), data.end());
+    auto end = std::chrono::system_clock::now();
+    if(!std::is_sorted(data.begin(), data.end())){
+        std::cerr << "not sorted" << std::endl;
+    }
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+}
+
+void measure_sample_sort(int max_exponent)
+{
+    // size array
+    std::vector<long long> size_array;
+    for(long long size = 1000000, exponent = 6; exponent <= max_exponent; size *= 10, ++exponent){
+        size_array.push_back(size);
+    }
+
+    // result
+    std::vector<std::vector<long long>> result(SortingAlgorithm::SIZE);
+
+    // the pool is shared by every measurement so that thread start-up is not measured
+    rtw::thread_pool pool;
+
+    std::vector<long long> measured;
+    for(long long size : size_array){
+        std::vector<std::uint64_t> data;
+        try{
+            data.resize(size);
+        }
+        catch(const std::bad_alloc&){
+            std::cout << "size: " << size << " does not fit in memory" << std::endl;
+            break;
+        }
+        measured.push_back(size);
+        result[INTRO_SORT].push_back(measure(data, [](auto first, auto last) -> void {
+            rtw::intro_sort(first, last);
+        }));
+        result[PARALLEL_SORT].push_back(measure(data, [&pool](auto first, auto last) -> void {
+            rtw::parallel_sort(pool, first, last);
+        }));
+        result[SAMPLE_SORT].push_back(measure(data, [](auto first, auto last) -> void {
+            rtw::sample_sort(first, last);
+        }));
+        result[PARALLEL_SAMPLE_SORT].push_back(measure(data, [&pool](auto first, auto last) -> void {
+            rtw::parallel_sample_sort(pool, first, last);
+        }));
+    }
+
+    // console out
+    std::cout << "threads: " << pool.size() << std::endl;
+    for(std::size_t i = 0; i < measured.size(); i++){
+        std::cout << "size: " << measured[i];
+        for(std::size_t algorithm = 0; algorithm < SortingAlgorithm::SIZE; algorithm++){
+            std::cout << ", " << names[algorithm] << ": " << result[algorithm][i] << " ms";
+        }
+        std::cout << std::endl;
+    }
+
+    // file out
+    std::ofstream ofs("sample_sort_result.csv");
+    if(ofs.is_open()){
+        ofs << "size,";
+        for(long long size : measured){
+            ofs << size << ",";
+        }
+        ofs << std::endl;
+        for(auto data = result.begin(); data != result.end(); ++data){
+            ofs << names[std::distance(result.begin(), data)] << ",";
+            for(long long elapsed : *data){
+                ofs << elapsed << ",";
+            }
+            ofs << std::endl;
+        }
+        ofs.close();
+    }
+}
\ No newline at end of file
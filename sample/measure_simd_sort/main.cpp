@@ -0,0 +1,7 @@
+extern void measure_simd_sort();
+
+int main()
+{
+    measure_simd_sort();
+    return 0;
+}
\ No newline at end of file
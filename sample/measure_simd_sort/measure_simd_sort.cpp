@@ -0,0 +1,94 @@
+#include <rtw/algorithm/intro_sort.hpp>
+#include <rtw/algorithm/order_statistic.hpp>
+#include <rtw/simd/isa.hpp>
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <fstream>
+#include <string>
+
+const std::vector<rtw::simd_isa> isa_array{ rtw::simd_isa::scalar, rtw::simd_isa::avx2, rtw::simd_isa::avx512 };
+const std::vector<std::string> names{ "scalar", "avx2", "avx512" };
+
+template<typename T>
+void measure(const std::string& type, const std::vector<int>& size_array, std::ofstream& ofs)
+{
+    for(std::size_t isa = 0; isa < isa_array.size(); isa++){
+        if(static_cast<int>(isa_array[isa]) > static_cast<int>(rtw::detect_simd_isa())){
+            continue;
+        }
+        rtw::set_simd_isa(isa_array[isa]);
+        std::vector<int> sort_result;
+        std::vector<int> nth_result;
+        for(int size : size_array){
+            // generate random data
+            std::mt19937_64 mt(size);
+            std::vector<T> original(size);
+            for(int i = 0; i < size; i++){
+                original[i] = static_cast<T>(mt());
+            }
+            std::vector<T> data(original);
+
+            // intro sort
+            auto start = std::chrono::system_clock::now();
+            rtw::intro_sort(data.data(), data.data() + size);
+            auto end = std::chrono::system_clock::now();
+            sort_result.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+
+            // nth element
+            std::copy(original.begin(), original.end(), data.begin());
+            start = std::chrono::system_clock::now();
+            rtw::nth_element(data.data(), data.data() + size / 2, data.data() + size);
+            end = std::chrono::system_clock::now();
+            nth_result.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+        }
+
+        // console out
+        for(std::size_t i = 0; i < size_array.size(); i++){
+            std::cout << type << ", " << names[isa] << ", size: " << size_array[i] << ", intro_sort: " << sort_result[i] << " us, nth_element: " << nth_result[i] << " us" << std::endl;
+        }
+
+        // file out
+        if(ofs.is_open()){
+            ofs << type << " intro_sort " << names[isa] << ",";
+            for(int elapsed : sort_result){
+                ofs << elapsed << ",";
+            }
+            ofs << std::endl;
+            ofs << type << " nth_element " << names[isa] << ",";
+            for(int elapsed : nth_result){
+                ofs << elapsed << ",";
+            }
+            ofs << std::endl;
+        }
+    }
+    rtw::set_simd_isa(rtw::detect_simd_isa());
+}
+
+void measure_simd_sort()
+{
+    // size array
+    std::vector<int> size_array;
+    for(int i = 10; i <= 24; i += 2){
+        size_array.push_back(std::pow(2, i));
+    }
+
+    std::ofstream ofs("simd_sort_result.csv");
+    if(ofs.is_open()){
+        ofs << "size,";
+        for(int size : size_array){
+            ofs << size << ",";
+        }
+        ofs << std::endl;
+    }
+
+    measure<std::int32_t>("int32", size_array, ofs);
+    measure<std::uint32_t>("uint32", size_array, ofs);
+    measure<std::int64_t>("int64", size_array, ofs);
+    measure<float>("float", size_array, ofs);
+    measure<double>("double", size_array, ofs);
+}
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <rtw/algorithm/heap.hpp>
 #include <rtw/algorithm/merge_sort.hpp>
 #include <rtw/algorithm/quick_sort.hpp>
+#include <rtw/algorithm/radix_sort.hpp>
 
 #include <iostream>
 #include <vector>
@@ -19,13 +20,14 @@ enum SortingAlgorithm{
     HEAP_SORT = 2, 
     MERGE_SORT = 3, 
     QUICK_SORT = 4, 
-    STD_HEAP_SORT = 5, 
-    STD_STABLE_SORT = 6, 
-    STD_SORT = 7, 
+    RADIX_SORT = 5, 
+    STD_HEAP_SORT = 6, 
+    STD_STABLE_SORT = 7, 
+    STD_SORT = 8, 
     SIZE
 };
 
-const std::vector<std::string> names{ "insertion_sort", "intro_sort", "heap_sort", "merge_sort", "quick_sort", "std::sort_heap", "std::stable_sort", "std::sort" };
+const std::vector<std::string> names{ "insertion_sort", "intro_sort", "heap_sort", "merge_sort", "quick_sort", "radix_sort", "std::sort_heap", "std::stable_sort", "std::sort" };
 
 inline void pre_sort(const std::vector<int>& original, std::vector<std::vector<int>>& data, std::chrono::system_clock::time_point& start)
 {
@@ -110,6 +112,14 @@ void measure_sorting_algorithms()
         }
         post_sort(start, end, result, SortingAlgorithm::QUICK_SORT);
 
+        // radix sort
+        std::vector<int> buffer(size);
+        pre_sort(original, data, start);
+        for(int i = 0; i < iteration; i++){
+            rtw::radix_sort(data[i].begin(), data[i].end(), buffer.begin());
+        }
+        post_sort(start, end, result, SortingAlgorithm::RADIX_SORT);
+
         // std heap sort
         pre_sort(original, data, start);
         for(int i = 0; i < iteration; i++){
@@ -0,0 +1,7 @@
+extern void measure_static_btree();
+
+int main()
+{
+    measure_static_btree();
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include <rtw/algorithm/binary_search.hpp>
+#include <rtw/algorithm/eytzinger_index.hpp>
+#include <rtw/algorithm/static_btree.hpp>
+#include <rtw/container/vector.hpp>
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <cstdint>
+
+const int query_count = 1 << 20;
+
+template<typename Search>
+int measure_queries(const std::vector<std::uint32_t>& queries, std::size_t& sum, Search search)
+{
+    sum = 0;
+    auto start = std::chrono::system_clock::now();
+    for(std::uint32_t query : queries){
+        sum += search(query);
+    }
+    auto end = std::chrono::system_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+
+void measure_static_btree()
+{
+    // size array, from 4 KB (L1) to 1 GB of keys
+    std::vector<int> size_array;
+    for(int i = 10; i <= 28; i += 2){
+        size_array.push_back(std::pow(2, i));
+    }
+
+    std::vector<int> binary_result;
+    std::vector<int> eytzinger_result;
+    std::vector<int> btree_result;
+    for(int size : size_array){
+        // sorted keys, generated in order, and random queries
+        std::mt19937 mt(size);
+        rtw::vector<std::uint32_t> keys(size);
+        for(int i = 0; i < size; i++){
+            keys[i] = static_cast<std::uint32_t>(i) * 8 + mt() % 8;
+        }
+        std::vector<std::uint32_t> queries(query_count);
+        for(auto& query : queries){
+            query = mt() % (static_cast<std::uint32_t>(size) * 8);
+        }
+
+        // rtw::lower_bound
+        std::size_t binary_sum;
+        binary_result.push_back(measure_queries(queries, binary_sum, [&](std::uint32_t query){
+            return static_cast<std::size_t>(rtw::lower_bound(keys.data(), keys.data() + size, query) - keys.data());
+        }));
+
+        // rtw::eytzinger_index, built and freed here to leave room for the largest sizes
+        std::size_t eytzinger_sum;
+        {
+            rtw::eytzinger_index<std::uint32_t> index(keys);
+            eytzinger_result.push_back(measure_queries(queries, eytzinger_sum, [&](std::uint32_t query){
+                return index.lower_bound(query);
+            }));
+        }
+
+        // rtw::static_btree
+        std::size_t btree_sum;
+        {
+            rtw::static_btree<std::uint32_t> tree(keys);
+            btree_result.push_back(measure_queries(queries, btree_sum, [&](std::uint32_t query){
+                return tree.lower_bound(query);
+            }));
+        }
+        if(binary_sum != eytzinger_sum || binary_sum != btree_sum){
+            std::cout << "mismatch at size " << size << std::endl;
+        }
+    }
+
+    // console out
+    for(std::size_t i = 0; i < size_array.size(); i++){
+        std::cout << "size: " << size_array[i] << ", " << query_count << " queries, rtw::lower_bound: " << binary_result[i]
+                  << " us, rtw::eytzinger_index: " << eytzinger_result[i] << " us, rtw::static_btree: " << btree_result[i] << " us" << std::endl;
+    }
+
+    // file out
+    std::ofstream ofs("static_btree_result.csv");
+    if(ofs.is_open()){
+        ofs << "size,";
+        for(int size : size_array){
+            ofs << size << ",";
+        }
+        ofs << std::endl;
+        ofs << "rtw::lower_bound,";
+        for(int elapsed : binary_result){
+            ofs << elapsed << ",";
+        }
+        ofs << std::endl;
+        ofs << "rtw::eytzinger_index,";
+        for(int elapsed : eytzinger_result){
+            ofs << elapsed << ",";
+        }
+        ofs << std::endl;
+        ofs << "rtw::static_btree,";
+        for(int elapsed : btree_result){
+            ofs << elapsed << ",";
+        }
+        ofs << std::endl;
+    }
+}
\ No newline at end of file
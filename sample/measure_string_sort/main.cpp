@@ -0,0 +1,7 @@
+extern void measure_string_sort();
+
+int main()
+{
+    measure_string_sort();
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+#include <rtw/algorithm/intro_sort.hpp>
+#include <rtw/algorithm/string_sort.hpp>
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <fstream>
+#include <string>
+
+enum SortingAlgorithm{
+    INTRO_SORT = 0,
+    STRING_SORT = 1,
+    STD_SORT = 2,
+    SIZE
+};
+
+const std::vector<std::string> names{ "intro_sort", "string_sort", "std::sort" };
+
+// URLs below a handful of hosts and paths, the kind of keys that share long prefixes
+std::string make_url(std::mt19937& mt)
+{
+    static const std::vector<std::string> hosts{ "https://www.example.com", "https://static.example.com", "https://www.example.org" };
+    static const std::vector<std::string> paths{ "/products/electronics/", "/products/books/", "/users/profile/", "/static/images/thumbnails/" };
+    return hosts[mt() % hosts.size()] + paths[mt() % paths.size()] + std::to_string(mt() % 1000000) + "/index.html";
+}
+
+// exchange-qualified symbols with an expiry suffix
+std::string make_symbol(std::mt19937& mt)
+{
+    static const std::vector<std::string> exchanges{ "XNAS.", "XNYS.", "XCME.FUT.", "XCME.OPT." };
+    std::string symbol = exchanges[mt() % exchanges.size()];
+    for(int i = 0; i < 4; i++){
+        symbol.push_back(static_cast<char>('A' + mt() % 6));
+    }
+    return symbol + ".2026" + std::to_string(10 + mt() % 3);
+}
+
+inline void pre_sort(const std::vector<std::string>& original, std::vector<std::string>& data, std::chrono::system_clock::time_point& start)
+{
+    std::copy(original.begin(), original.end(), data.begin());
+    start = std::chrono::system_clock::now();
+}
+
+inline void post_sort(const std::chrono::system_clock::time_point& start, std::chrono::system_clock::time_point& end, std::vector<std::vector<int>>& result, SortingAlgorithm algorithm)
+{
+    end = std::chrono::system_clock::now();
+    int elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    result[algorithm].push_back(elapsed);
+}
+
+void measure(const std::string& type, std::string (*generate)(std::mt19937&), const std::vector<int>& size_array, std::ofstream& ofs)
+{
+    // result
+    std::vector<std::vector<int>> result(SortingAlgorithm::SIZE);
+
+    // sort
+    for(int size : size_array){
+        // generate data
+        std::mt19937 mt(size);
+        std::vector<std::string> original(size);
+        for(int i = 0; i < size; i++){
+            original[i] = generate(mt);
+        }
+        std::vector<std::string> data(size);
+
+        // timer
+        std::chrono::system_clock::time_point start, end;
+
+        // intro sort
+        pre_sort(original, data, start);
+        rtw::intro_sort(data.begin(), data.end());
+        post_sort(start, end, result, SortingAlgorithm::INTRO_SORT);
+
+        // string sort
+        pre_sort(original, data, start);
+        rtw::string_sort(data.begin(), data.end());
+        post_sort(start, end, result, SortingAlgorithm::STRING_SORT);
+
+        // std::sort
+        pre_sort(original, data, start);
+        std::sort(data.begin(), data.end());
+        post_sort(start, end, result, SortingAlgorithm::STD_SORT);
+    }
+
+    // console out
+    for(std::size_t i = 0; i < size_array.size(); i++){
+        std::cout << type << ", size: " << size_array[i];
+        for(int algorithm = 0; algorithm < SortingAlgorithm::SIZE; algorithm++){
+            std::cout << ", " << names[algorithm] << ": " << result[algorithm][i] << " us";
+        }
+        std::cout << std::endl;
+    }
+
+    // file out
+    if(ofs.is_open()){
+        for(auto data = result.begin(); data != result.end(); ++data){
+            ofs << type << " " << names[std::distance(result.begin(), data)] << ",";
+            for(int elapsed : *data){
+                ofs << elapsed << ",";
+            }
+            ofs << std::endl;
+        }
+    }
+}
+
+void measure_string_sort()
+{
+    // size array
+    std::vector<int> size_array;
+    for(int i = 12; i <= 20; i += 2){
+        size_array.push_back(std::pow(2, i));
+    }
+
+    std::ofstream ofs("string_sort_result.csv");
+    if(ofs.is_open()){
+        ofs << "size,";
+        for(int size : size_array){
+            ofs << size << ",";
+        }
+        ofs << std::endl;
+    }
+
+    measure("url", make_url, size_array, ofs);
+    measure("symbol", make_symbol, size_array, ofs);
+}
\ No newline at end of file
@@ -0,0 +1,7 @@
+extern void measure_tim_sort();
+
+int main()
+{
+    measure_tim_sort();
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include <rtw/algorithm/merge_sort.hpp>
+#include <rtw/algorithm/tim_sort.hpp>
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <fstream>
+#include <string>
+
+enum InputPattern{
+    SORTED = 0,
+    NEARLY_SORTED = 1,
+    REVERSED = 2,
+    RANDOM = 3,
+    PATTERN_SIZE
+};
+
+enum SortingAlgorithm{
+    MERGE_SORT = 0,
+    TIM_SORT = 1,
+    SIZE
+};
+
+const std::vector<std::string> pattern_names{ "sorted", "nearly_sorted", "reversed", "random" };
+const std::vector<std::string> names{ "merge_sort", "tim_sort" };
+
+inline void generate(InputPattern pattern, int size, std::mt19937& mt, std::vector<int>& original)
+{
+    original.resize(size);
+    for(int i = 0; i < size; i++){
+        original[i] = pattern == REVERSED ? size - i : i;
+    }
+    if(pattern == NEARLY_SORTED){
+        // appended time series: a few late elements land out of place
+        for(int i = 0; i < size / 100; i++){
+            int position = mt() % size;
+            int distance = mt() % 32;
+            std::swap(original[position], original[std::min(position + distance, size - 1)]);
+        }
+    }
+    else if(pattern == RANDOM){
+        std::shuffle(original.begin(), original.end(), mt);
+    }
+}
+
+inline void pre_sort(const std::vector<int>& original, std::vector<std::vector<int>>& data, std::chrono::system_clock::time_point& start)
+{
+    for(std::vector<int>& one_data : data){
+        std::copy(original.begin(), original.end(), one_data.begin());
+    }
+    start = std::chrono::system_clock::now();
+}
+
+inline int post_sort(const std::chrono::system_clock::time_point& start, std::chrono::system_clock::time_point& end)
+{
+    end = std::chrono::system_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+
+void measure_tim_sort()
+{
+    // size array
+    std::vector<int> size_array;
+    for(int i = 10; i <= 20; i += 2){
+        size_array.push_back(std::pow(2, i));
+    }
+
+    // result[pattern][algorithm][size]
+    std::vector<std::vector<std::vector<int>>> result(PATTERN_SIZE, std::vector<std::vector<int>>(SortingAlgorithm::SIZE));
+
+    std::random_device rnd;
+    std::mt19937 mt(rnd());
+    for(int size : size_array){
+        // iteration
+        int iteration = std::max(1, (1 << 22) / size);
+        std::vector<std::vector<int>> data(iteration, std::vector<int>(size));
+
+        for(int pattern = 0; pattern < PATTERN_SIZE; pattern++){
+            std::vector<int> original;
+            generate(static_cast<InputPattern>(pattern), size, mt, original);
+
+            // timer
+            std::chrono::system_clock::time_point start, end;
+
+            // merge sort
+            pre_sort(original, data, start);
+            for(int i = 0; i < iteration; i++){
+                rtw::merge_sort(data[i].begin(), data[i].end());
+            }
+            result[pattern][MERGE_SORT].push_back(post_sort(start, end));
+
+            // tim sort
+            pre_sort(original, data, start);
+            for(int i = 0; i < iteration; i++){
+                rtw::tim_sort(data[i].begin(), data[i].end());
+            }
+            result[pattern][TIM_SORT].push_back(post_sort(start, end));
+        }
+    }
+
+    // file out
+    std::ofstream ofs("tim_sort_result.csv");
+    if(ofs.is_open()){
+        ofs << "size,";
+        for(int size : size_array){
+            ofs << size << ",";
+        }
+        ofs << std::endl;
+        for(int pattern = 0; pattern < PATTERN_SIZE; pattern++){
+            for(int algorithm = 0; algorithm < SortingAlgorithm::SIZE; algorithm++){
+                ofs << pattern_names[pattern] << ":" << names[algorithm] << ",";
+                for(int elapsed : result[pattern][algorithm]){
+                    ofs << elapsed << ",";
+                }
+                ofs << std::endl;
+            }
+        }
+        ofs.close();
+    }
+}
\ No newline at end of file
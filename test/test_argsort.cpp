@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <rtw/algorithm/argsort.hpp>
+
+#include <vector>
+#include <deque>
+#include <random>
+#include <string>
+#include <cstdint>
+#include <algorithm>
+
+class ArgsortTest : public ::testing::Test{
+protected:
+    ArgsortTest() {}
+    virtual ~ArgsortTest() {}
+    virtual void SetUp() override {}
+    virtual void TearDown() override {}
+};
+
+TEST_F(ArgsortTest, Argsort)
+{
+    std::vector<int> v{ 40, 10, 30, 50, 20 };
+    rtw::vector<std::uint32_t> index = rtw::argsort(v.begin(), v.end());
+    EXPECT_TRUE((std::vector<std::uint32_t>{ 1, 4, 2, 0, 3 }) == std::vector<std::uint32_t>(index.begin(), index.end()));
+
+    index = rtw::argsort(v.begin(), v.end(), std::greater<int>());
+    EXPECT_TRUE((std::vector<std::uint32_t>{ 3, 0, 2, 4, 1 }) == std::vector<std::uint32_t>(index.begin(), index.end()));
+}
+
+TEST_F(ArgsortTest, NonArithmetic)
+{
+    std::deque<std::string> d{ "pear", "apple", "fig", "banana" };
+    rtw::vector<std::uint64_t> index = rtw::argsort<std::uint64_t>(d.begin(), d.end());
+    EXPECT_TRUE((std::vector<std::uint64_t>{ 1, 3, 2, 0 }) == std::vector<std::uint64_t>(index.begin(), index.end()));
+}
+
+TEST_F(ArgsortTest, SmallSize)
+{
+    std::vector<int> v0{  };
+    EXPECT_EQ(0u, rtw::argsort(v0.begin(), v0.end()).size());
+
+    std::vector<int> v1{ 1 };
+    rtw::vector<std::uint32_t> index = rtw::argsort(v1.begin(), v1.end());
+    EXPECT_EQ(1u, index.size());
+    EXPECT_EQ(0u, index[0]);
+}
+
+TEST_F(ArgsortTest, StableArgsort)
+{
+    std::mt19937 mt(0);
+    static const int size = 5000;
+    std::vector<int> key(size);
+    std::vector<std::string> name(size);
+    for(int i = 0; i < size; i++){
+        key[i] = mt() % 10;
+        name[i] = std::to_string(mt() % 10);
+    }
+    rtw::vector<std::uint32_t> index = rtw::stable_argsort(key.begin(), key.end());
+    for(int i = 1; i < size; i++){
+        EXPECT_TRUE(key[index[i - 1]] < key[index[i]] || (key[index[i - 1]] == key[index[i]] && index[i - 1] < index[i]));
+    }
+
+    index = rtw::stable_argsort(name.begin(), name.end());
+    for(int i = 1; i < size; i++){
+        EXPECT_TRUE(name[index[i - 1]] < name[index[i]] || (name[index[i - 1]] == name[index[i]] && index[i - 1] < index[i]));
+    }
+}
+
+TEST_F(ArgsortTest, ApplyPermutation)
+{
+    std::vector<int> key{ 40, 10, 30, 50, 20 };
+    std::vector<std::string> name{ "d", "a", "c", "e", "b" };
+    std::deque<double> value{ 4.0, 1.0, 3.0, 5.0, 2.0 };
+    rtw::vector<std::uint32_t> index = rtw::argsort(key.begin(), key.end());
+    rtw::apply_permutation(index.begin(), index.end(), key.begin(), name.begin(), value.begin());
+    EXPECT_TRUE((std::vector<int>{ 10, 20, 30, 40, 50 }) == key);
+    EXPECT_TRUE((std::vector<std::string>{ "a", "b", "c", "d", "e" }) == name);
+    EXPECT_TRUE((std::deque<double>{ 1.0, 2.0, 3.0, 4.0, 5.0 }) == value);
+    for(std::uint32_t i = 0; i < index.size(); i++){
+        EXPECT_EQ(i, index[i]);
+    }
+}
+
+TEST_F(ArgsortTest, ApplyRandomPermutation)
+{
+    std::mt19937 mt(0);
+    static const int size = 10000;
+    std::vector<std::uint64_t> key(size);
+    std::vector<std::uint64_t> payload(size);
+    for(int i = 0; i < size; i++){
+        key[i] = mt();
+        payload[i] = key[i] * 3 + 1;
+    }
+    std::vector<std::uint64_t> expected(key);
+    std::sort(expected.begin(), expected.end());
+
+    rtw::vector<std::uint32_t> index = rtw::argsort(key.begin(), key.end());
+    rtw::apply_permutation(index.begin(), index.end(), key.begin(), payload.begin());
+    EXPECT_TRUE(expected == key);
+    for(int i = 0; i < size; i++){
+        EXPECT_EQ(key[i] * 3 + 1, payload[i]);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include <rtw/algorithm/block_merge_sort.hpp>
+
+#include <array>
+#include <vector>
+#include <deque>
+#include <random>
+#include <utility>
+#include <algorithm>
+
+class BlockMergeSortTest : public ::testing::Test{
+protected:
+    BlockMergeSortTest() {}
+    virtual ~BlockMergeSortTest() {}
+    virtual void SetUp() override {}
+    virtual void TearDown() override {}
+};
+
+TEST_F(BlockMergeSortTest, CStyleArray)
+{
+    int a[5] = { 4, 3, 1, 5, 2 };
+    rtw::block_merge_sort(a, a + 5);
+    EXPECT_TRUE(std::is_sorted(a, a + 5));
+}
+
+TEST_F(BlockMergeSortTest, RandomAccessIterator)
+{
+    std::array<int, 5> a{ 4, 1, 3, 5, 2 };
+    rtw::block_merge_sort(a.begin(), a.end());
+    EXPECT_TRUE(std::is_sorted(a.begin(), a.end()));
+
+    std::vector<int> v{ 6, 4, 1, 3, 5, 2 };
+    rtw::block_merge_sort(v.begin(), v.end());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+
+    std::deque<int> d{ 4, 1, 3, 5, 2 };
+    rtw::block_merge_sort(d.begin(), d.end());
+    EXPECT_TRUE(std::is_sorted(d.begin(), d.end()));
+}
+
+TEST_F(BlockMergeSortTest, Compare)
+{
+    std::vector<int> v{ 6, 4, 1, 3, 5, 2 };
+    rtw::block_merge_sort(v.begin(), v.end(), std::greater<int>());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end(), std::greater<int>()));
+
+    std::deque<int> d(1000);
+    for(int i = 0; i < 1000; i++){
+        d[i] = (i * 7919) % 1000;
+    }
+    rtw::block_merge_sort(d.begin(), d.end(), std::greater<int>(), 0);
+    EXPECT_TRUE(std::is_sorted(d.begin(), d.end(), std::greater<int>()));
+}
+
+TEST_F(BlockMergeSortTest, SmallSize)
+{
+    std::vector<int> v0{  };
+    rtw::block_merge_sort(v0.begin(), v0.end());
+    EXPECT_TRUE(std::is_sorted(v0.begin(), v0.end()));
+
+    std::vector<int> v1{ 1 };
+    rtw::block_merge_sort(v1.begin(), v1.end());
+    EXPECT_TRUE(std::is_sorted(v1.begin(), v1.end()));
+
+    std::vector<int> v2{ 2, 1 };
+    rtw::block_merge_sort(v2.begin(), v2.end(), std::less<int>(), 0);
+    EXPECT_TRUE(std::is_sorted(v2.begin(), v2.end()));
+}
+
+TEST_F(BlockMergeSortTest, LargeRandom)
+{
+    std::random_device rnd;
+    std::mt19937 mt(rnd());
+
+    for(int size : { 31, 32, 33, 64, 100, 1000, 4097, 100000 }){
+        std::vector<int> v(size);
+        for(int i = 0; i < size; i++){
+            v[i] = mt();
+        }
+        std::vector<int> expected(v);
+        std::sort(expected.begin(), expected.end());
+
+        rtw::block_merge_sort(v.begin(), v.end());
+        EXPECT_TRUE(expected == v);
+    }
+}
+
+TEST_F(BlockMergeSortTest, Presorted)
+{
+    static const int size = 10000;
+    std::vector<int> ascending(size);
+    std::vector<int> descending(size);
+    for(int i = 0; i < size; i++){
+        ascending[i] = i;
+        descending[i] = size - i;
+    }
+    rtw::block_merge_sort(ascending.begin(), ascending.end());
+    EXPECT_TRUE(std::is_sorted(ascending.begin(), ascending.end()));
+    rtw::block_merge_sort(descending.begin(), descending.end());
+    EXPECT_TRUE(std::is_sorted(descending.begin(), descending.end()));
+}
+
+TEST_F(BlockMergeSortTest, Stable)
+{
+    std::mt19937 mt(0);
+    auto compare = [](const std::pair<int, int>& lhs, const std::pair<int, int>& rhs) -> bool { return lhs.first < rhs.first; };
+
+    // few and many distinct keys, without a buffer, with less than and with the square root of the size
+    for(int size : { 1000, 20000 }){
+        for(int keys : { 3, 64, 1 << 30 }){
+            std::vector<std::pair<int, int>> v(size);
+            for(int i = 0; i < size; i++){
+                v[i] = std::make_pair(static_cast<int>(mt() % keys), i);
+            }
+            std::vector<std::pair<int, int>> expected(v);
+            std::stable_sort(expected.begin(), expected.end(), compare);
+
+            std::size_t root = rtw::block_merge_sort_buffer_size(size);
+            for(std::size_t buffer_size : { std::size_t(0), std::size_t(1), std::size_t(5), root / 2, root, std::size_t(size) }){
+                std::vector<std::pair<int, int>> sorted(v);
+                rtw::block_merge_sort(sorted.begin(), sorted.end(), compare, buffer_size);
+                EXPECT_TRUE(expected == sorted);
+            }
+        }
+    }
+}
+
+TEST_F(BlockMergeSortTest, Buffer)
+{
+    std::mt19937 mt(0);
+
+    static const int size = 5000;
+    std::vector<int> v(size);
+    for(int i = 0; i < size; i++){
+        v[i] = mt() % 100;
+    }
+    std::vector<int> expected(v);
+    std::sort(expected.begin(), expected.end());
+
+    int buffer[71];
+    rtw::block_merge_sort(v.begin(), v.end(), buffer, 71, std::less<int>());
+    EXPECT_TRUE(expected == v);
+}
\ No newline at end of file
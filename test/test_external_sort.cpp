@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <rtw/algorithm/external_sort.hpp>
+
+#include <vector>
+#include <random>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include <algorithm>
+#include <fstream>
+#include <filesystem>
+#include <system_error>
+#include <stdexcept>
+
+class ExternalSortTest : public ::testing::Test{
+protected:
+    ExternalSortTest() {}
+    virtual ~ExternalSortTest() {}
+    virtual void SetUp() override {
+        directory_ = std::filesystem::temp_directory_path() / ("rtw_external_sort_test_" + std::to_string(::getpid()));
+        std::filesystem::create_directories(directory_);
+    }
+    virtual void TearDown() override {
+        std::filesystem::remove_all(directory_);
+    }
+protected:
+    std::string path(const std::string& name) const {
+        return (directory_ / name).string();
+    }
+    template<typename T>
+    void write(const std::string& name, const std::vector<T>& v) const {
+        std::ofstream ofs(path(name), std::ios::binary);
+        ofs.write(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T));
+    }
+    template<typename T>
+    std::vector<T> read(const std::string& name) const {
+        std::vector<T> v(std::filesystem::file_size(path(name)) / sizeof(T));
+        std::ifstream ifs(path(name), std::ios::binary);
+        ifs.read(reinterpret_cast<char*>(v.data()), v.size() * sizeof(T));
+        return v;
+    }
+    rtw::external_sort_options options(std::size_t memory_budget, std::size_t io_buffer_size) const {
+        rtw::external_sort_options options;
+        options.memory_budget = memory_budget;
+        options.io_buffer_size = io_buffer_size;
+        options.temp_directory = directory_.string();
+        return options;
+    }
+private:
+    std::filesystem::path directory_;
+};
+
+struct external_record{
+    std::uint32_t key;
+    std::uint32_t value;
+    char payload[8];
+};
+
+TEST_F(ExternalSortTest, InMemory)
+{
+    std::mt19937_64 engine(1);
+    std::vector<std::uint64_t> v(1000);
+    for(auto& x : v){ x = engine(); }
+    write("input", v);
+    rtw::external_sort<std::uint64_t>(path("input"), path("output"), options(1 << 20, 1 << 12));
+    std::sort(v.begin(), v.end());
+    EXPECT_TRUE(v == read<std::uint64_t>("output"));
+}
+
+TEST_F(ExternalSortTest, Runs)
+{
+    std::mt19937_64 engine(2);
+    std::vector<std::uint64_t> v(50000);
+    for(auto& x : v){ x = engine() % 1000; }
+    write("input", v);
+    // 37 runs of 1365 records merged in one pass
+    rtw::external_sort<std::uint64_t>(path("input"), path("output"), options(1 << 15, 1 << 9));
+    std::sort(v.begin(), v.end());
+    EXPECT_TRUE(v == read<std::uint64_t>("output"));
+}
+
+TEST_F(ExternalSortTest, MultiPass)
+{
+    std::mt19937_64 engine(3);
+    std::vector<external_record> v(30000);
+    for(std::size_t i = 0; i < v.size(); ++i){
+        v[i].key = static_cast<std::uint32_t>(engine());
+        v[i].value = static_cast<std::uint32_t>(i);
+        std::fill(v[i].payload, v[i].payload + 8, static_cast<char>(i));
+    }
+    write("input", v);
+    // 177 runs of 170 records, 7 merged at a time over three passes
+    auto greater = [](const external_record& lhs, const external_record& rhs) -> bool {
+        return lhs.key > rhs.key;
+    };
+    rtw::external_sort<external_record>(path("input"), path("input"), greater, options(1 << 13, 1 << 10));
+    std::vector<external_record> sorted = read<external_record>("input");
+    ASSERT_EQ(v.size(), sorted.size());
+    EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end(), greater));
+    std::vector<std::uint32_t> values;
+    for(const auto& r : sorted){
+        EXPECT_EQ(static_cast<char>(r.value), r.payload[7]);
+        values.push_back(r.value);
+    }
+    std::sort(values.begin(), values.end());
+    for(std::size_t i = 0; i < values.size(); ++i){
+        EXPECT_EQ(i, values[i]);
+    }
+}
+
+TEST_F(ExternalSortTest, SmallBudget)
+{
+    std::mt19937_64 engine(4);
+    std::vector<std::uint32_t> v(5000);
+    for(auto& x : v){
+        x = static_cast<std::uint32_t>(engine());
+    }
+    write("input", v);
+    // the smallest budget, three io buffers of 16 records: hundreds of runs merged two at a time
+    rtw::external_sort<std::uint32_t>(path("input"), path("output"), options(192, 64));
+    std::sort(v.begin(), v.end());
+    EXPECT_TRUE(v == read<std::uint32_t>("output"));
+}
+
+TEST_F(ExternalSortTest, SmallSize)
+{
+    write("input", std::vector<std::uint32_t>{});
+    rtw::external_sort<std::uint32_t>(path("input"), path("output"), options(1 << 10, 1 << 8));
+    EXPECT_TRUE(read<std::uint32_t>("output").empty());
+
+    write("input", std::vector<std::uint32_t>{ 3, 1, 2 });
+    rtw::external_sort<std::uint32_t>(path("input"), path("output"), options(12, 4));
+    EXPECT_TRUE((std::vector<std::uint32_t>{ 1, 2, 3 }) == read<std::uint32_t>("output"));
+}
+
+TEST_F(ExternalSortTest, Error)
+{
+    write("input", std::vector<char>{ 1, 2, 3 });
+    EXPECT_THROW(rtw::external_sort<std::uint32_t>(path("input"), path("output")), std::invalid_argument);
+    EXPECT_THROW(rtw::external_sort<std::uint32_t>(path("missing"), path("output")), std::system_error);
+
+    write("input", std::vector<std::uint32_t>{ 3, 1, 2 });
+    EXPECT_THROW(rtw::external_sort<std::uint32_t>(path("input"), path("output"), options(1 << 10, 0)), std::invalid_argument);
+    EXPECT_THROW(rtw::external_sort<std::uint32_t>(path("input"), path("output"), options(1 << 10, 1 << 12)), std::invalid_argument);
+    EXPECT_THROW(rtw::external_sort<std::uint32_t>(path("input"), path("output"), options(191, 64)), std::invalid_argument);
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <rtw/algorithm/eytzinger_index.hpp>
+#include <rtw/container/vector.hpp>
+
+#include <vector>
+#include <random>
+#include <string>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+
+class EytzingerIndexTest : public ::testing::Test{
+protected:
+    EytzingerIndexTest() {}
+    virtual ~EytzingerIndexTest() {}
+    virtual void SetUp() override {}
+    virtual void TearDown() override {}
+};
+
+TEST_F(EytzingerIndexTest, Empty)
+{
+    rtw::eytzinger_index<int> index;
+    EXPECT_TRUE(index.empty());
+    EXPECT_EQ(0u, index.size());
+    EXPECT_EQ(0u, index.lower_bound(1));
+    EXPECT_EQ(0u, index.upper_bound(1));
+    EXPECT_FALSE(index.contains(1));
+}
+
+TEST_F(EytzingerIndexTest, RtwVector)
+{
+    rtw::vector<int> v{ 1, 3, 5, 7, 9, 11, 13 };
+    rtw::eytzinger_index<int> index(v);
+    EXPECT_EQ(7u, index.size());
+    EXPECT_EQ(0u, index.lower_bound(0));
+    EXPECT_EQ(1u, index.lower_bound(3));
+    EXPECT_EQ(2u, index.lower_bound(4));
+    EXPECT_EQ(7u, index.lower_bound(14));
+    EXPECT_EQ(2u, index.upper_bound(3));
+    EXPECT_TRUE(index.contains(13));
+    EXPECT_FALSE(index.contains(12));
+    for(std::size_t rank = 0; rank < v.size(); rank++){
+        EXPECT_EQ(v[rank], index[rank]);
+    }
+}
+
+TEST_F(EytzingerIndexTest, EverySize)
+{
+    // complete trees of every shape of their last level, with duplicates and values outside the range
+    std::mt19937 mt(0);
+    for(int size = 1; size < 300; size++){
+        std::vector<int> v(size);
+        for(auto& x : v){ x = static_cast<int>(mt() % (size / 2 + 1)); }
+        std::sort(v.begin(), v.end());
+        rtw::eytzinger_index<int> index(v.begin(), v.end());
+        for(int rank = 0; rank < size; rank++){
+            EXPECT_EQ(v[rank], index[rank]) << "size " << size;
+        }
+        for(int value = -1; value <= size / 2 + 1; value++){
+            EXPECT_EQ(static_cast<std::size_t>(std::lower_bound(v.begin(), v.end(), value) - v.begin()), index.lower_bound(value)) << "size " << size;
+            EXPECT_EQ(static_cast<std::size_t>(std::upper_bound(v.begin(), v.end(), value) - v.begin()), index.upper_bound(value)) << "size " << size;
+            EXPECT_EQ(std::binary_search(v.begin(), v.end(), value), index.contains(value)) << "size " << size;
+        }
+    }
+}
+
+TEST_F(EytzingerIndexTest, Large)
+{
+    std::mt19937 mt(0);
+    rtw::vector<std::uint64_t> v;
+    for(int i = 0; i < 1000000; i++){
+        v.push_back(static_cast<std::uint64_t>(i) * 8 + mt() % 8);
+    }
+    rtw::eytzinger_index<std::uint64_t> index(v);
+    for(int i = 0; i < 10000; i++){
+        std::uint64_t value = mt() % 8000008;
+        EXPECT_EQ(static_cast<std::size_t>(std::lower_bound(v.begin(), v.end(), value) - v.begin()), index.lower_bound(value));
+    }
+}
+
+TEST_F(EytzingerIndexTest, Narrow)
+{
+    // 16 keys of 16 bits fill half a cache line, so the blocks are padded and no longer back to back
+    static_assert(sizeof(rtw::eytzinger_index<std::uint16_t>::block) == 64, "one block per line");
+    std::vector<std::uint16_t> v;
+    for(int i = 0; i < 5000; i++){
+        v.push_back(static_cast<std::uint16_t>(i * 3));
+    }
+    rtw::eytzinger_index<std::uint16_t> index(v.begin(), v.end());
+    for(int value = 0; value < 15002; value++){
+        std::uint16_t key = static_cast<std::uint16_t>(value);
+        EXPECT_EQ(static_cast<std::size_t>(std::lower_bound(v.begin(), v.end(), key) - v.begin()), index.lower_bound(key));
+        EXPECT_EQ(static_cast<std::size_t>(std::upper_bound(v.begin(), v.end(), key) - v.begin()), index.upper_bound(key));
+    }
+    EXPECT_EQ(v[4321], index[4321]);
+}
+
+TEST_F(EytzingerIndexTest, Compare)
+{
+    std::vector<std::string> v{ "pear", "lemon", "grape", "banana", "apple" };
+    rtw::eytzinger_index<std::string, std::greater<std::string>> index(v.begin(), v.end());
+    EXPECT_EQ(1u, index.lower_bound("lemon"));
+    EXPECT_EQ(2u, index.lower_bound("kiwi"));
+    EXPECT_EQ(5u, index.lower_bound("a"));
+    EXPECT_EQ("grape", index[2]);
+
+    rtw::eytzinger_index<std::string, std::greater<std::string>> other;
+    swap(index, other);
+    EXPECT_TRUE(index.empty());
+    EXPECT_EQ(5u, other.size());
+}
\ No newline at end of file
@@ -160,4 +160,91 @@ TEST_F(HeapTest, Random)
     EXPECT_TRUE(std::is_heap(v.begin(), v.end()));
     rtw::sort_heap(v.begin(), v.end());
     EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+}
+
+// every node is not less than its Arity children
+template<std::size_t Arity, typename RandomAccessIterator>
+bool is_dary_heap(RandomAccessIterator first, RandomAccessIterator last)
+{
+    for(std::ptrdiff_t i = 1; i < last - first; i++){
+        if(first[(i - 1) / static_cast<std::ptrdiff_t>(Arity)] < first[i]){
+            return false;
+        }
+    }
+    return true;
+}
+
+template<std::size_t Arity>
+void check_dary_heap()
+{
+    std::mt19937 mt(static_cast<unsigned int>(Arity));
+
+    static const int arity = static_cast<int>(Arity);
+    for(int size : { 0, 1, 2, 3, arity - 1, arity, arity + 1, arity * arity + 1, 1000 }){
+        std::vector<int> v(size);
+        for(int i = 0; i < size; i++){
+            v[i] = mt() % 100;
+        }
+        rtw::make_heap<Arity>(v.begin(), v.end());
+        EXPECT_TRUE(is_dary_heap<Arity>(v.begin(), v.end()));
+        std::vector<int> sorted(v);
+        rtw::sort_heap<Arity>(sorted.begin(), sorted.end());
+        EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end()));
+
+        v.push_back(static_cast<int>(mt() % 100));
+        rtw::push_heap<Arity>(v.begin(), v.end());
+        EXPECT_TRUE(is_dary_heap<Arity>(v.begin(), v.end()));
+        int top = v.front();
+        rtw::pop_heap<Arity>(v.begin(), v.end());
+        EXPECT_EQ(top, v.back());
+        EXPECT_TRUE(is_dary_heap<Arity>(v.begin(), std::prev(v.end())));
+        v.pop_back();
+        if(v.size() > 2){
+            EXPECT_TRUE(rtw::set_heap_key<Arity>(v.begin(), v.begin() + v.size() / 2, 1000));
+            EXPECT_EQ(1000, v.front());
+            EXPECT_TRUE(is_dary_heap<Arity>(v.begin(), v.end()));
+        }
+    }
+}
+
+TEST_F(HeapTest, Arity)
+{
+    check_dary_heap<2>();
+    check_dary_heap<3>();
+    check_dary_heap<4>();
+    check_dary_heap<8>();
+
+    std::array<int, 9> a{ 4, 1, 3, 5, 2, 9, 7, 8, 6 };
+    rtw::make_heap<4>(a.begin(), a.end(), std::greater<int>());
+    EXPECT_EQ(1, a.front());
+    rtw::sort_heap<4>(a.begin(), a.end(), std::greater<int>());
+    EXPECT_TRUE(std::is_sorted(a.begin(), a.end(), std::greater<int>()));
+}
+
+TEST_F(HeapTest, BottomUpComparisons)
+{
+    std::mt19937 mt(0);
+
+    static const int size = 10000;
+    std::vector<int> v(size);
+    for(int i = 0; i < size; i++){
+        v[i] = mt();
+    }
+    rtw::make_heap(v.begin(), v.end());
+    std::vector<int> top_down(v);
+
+    long long comparisons = 0;
+    auto compare = [&comparisons](int lhs, int rhs) -> bool { ++comparisons; return lhs < rhs; };
+    rtw::sort_heap(v.begin(), v.end(), compare);
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+    long long bottom_up = comparisons;
+
+    // the same pops sifting down from the root
+    comparisons = 0;
+    for(auto last = top_down.end(); last - top_down.begin() > 1; --last){
+        std::iter_swap(top_down.begin(), last - 1);
+        rtw::adjust_heap(top_down.begin(), top_down.begin(), last - 1, compare);
+    }
+    EXPECT_TRUE(v == top_down);
+    EXPECT_LT(bottom_up * 10, comparisons * 6);
 }
\ No newline at end of file
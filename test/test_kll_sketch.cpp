@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <rtw/algorithm/kll_sketch.hpp>
+#include <rtw/algorithm/order_statistic.hpp>
+
+#include <vector>
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+class KllSketchTest : public ::testing::Test{
+protected:
+    KllSketchTest() {}
+    virtual ~KllSketchTest() {}
+    virtual void SetUp() override {}
+    virtual void TearDown() override {}
+};
+
+// a shuffled permutation of 0, ..., size - 1, so that the rank of every value is the value itself
+std::vector<int> make_stream(int size, unsigned seed)
+{
+    std::vector<int> v(size);
+    std::iota(v.begin(), v.end(), 0);
+    std::shuffle(v.begin(), v.end(), std::mt19937(seed));
+    return v;
+}
+
+// the largest rank error of the sketch over the percentiles, as fractions of the stream length: the estimated rank of
+// the exact quantile that rtw::nth_element finds, and the exact rank of the quantile the sketch estimates
+double max_rank_error(const rtw::kll_sketch<int>& sketch, const std::vector<int>& stream)
+{
+    std::vector<int> data(stream);
+    double n = static_cast<double>(data.size());
+    double error = 0.0;
+    for(int percent = 1; percent < 100; percent++){
+        double fraction = percent / 100.0;
+        std::size_t k = static_cast<std::size_t>(fraction * n);
+        rtw::nth_element(data.begin(), data.begin() + k, data.end());
+        int exact = data[k];
+        error = std::max(error, std::fabs(sketch.rank(exact) - fraction));
+
+        int estimate = sketch.quantile(fraction);
+        auto less = std::count_if(stream.begin(), stream.end(), [&](int x){ return x < estimate; });
+        error = std::max(error, std::fabs(static_cast<double>(less) / n - fraction));
+    }
+    return error;
+}
+
+TEST_F(KllSketchTest, Empty)
+{
+    rtw::kll_sketch<int> sketch;
+    EXPECT_TRUE(sketch.empty());
+    EXPECT_EQ(0u, sketch.size());
+    EXPECT_EQ(0u, sketch.retained());
+    EXPECT_EQ(0.0, sketch.rank(1));
+}
+
+TEST_F(KllSketchTest, Exact)
+{
+    // below k every item is held with weight one and the answers are exact
+    std::vector<int> stream = make_stream(150, 0);
+    rtw::kll_sketch<int> sketch;
+    for(int x : stream){
+        sketch.insert(x);
+    }
+    EXPECT_EQ(150u, sketch.size());
+    EXPECT_EQ(150u, sketch.retained());
+    EXPECT_EQ(0, sketch.min());
+    EXPECT_EQ(149, sketch.max());
+    std::vector<int> data(stream);
+    for(int percent = 1; percent < 100; percent++){
+        double fraction = percent / 100.0;
+        std::size_t k = static_cast<std::size_t>(fraction * 150);
+        rtw::nth_element(data.begin(), data.begin() + k, data.end());
+        EXPECT_EQ(data[k], sketch.quantile(fraction)) << "fraction " << fraction;
+        EXPECT_EQ(static_cast<double>(data[k]) / 150, sketch.rank(data[k]));
+    }
+    EXPECT_EQ(0, sketch.quantile(0.0));
+    EXPECT_EQ(149, sketch.quantile(1.0));
+}
+
+TEST_F(KllSketchTest, RankError)
+{
+    for(std::size_t k : { 64, 200, 400 }){
+        std::vector<int> stream = make_stream(200000, static_cast<unsigned>(k));
+        rtw::kll_sketch<int> sketch(k);
+        for(int x : stream){
+            sketch.insert(x);
+        }
+        EXPECT_EQ(stream.size(), sketch.size());
+        double error = max_rank_error(sketch, stream);
+        EXPECT_LE(error, rtw::kll_sketch<int>::normalized_rank_error(k)) << "k " << k;
+    }
+}
+
+TEST_F(KllSketchTest, BoundedMemory)
+{
+    rtw::kll_sketch<int> sketch(100);
+    std::mt19937 mt(0);
+    std::size_t most = 0;
+    for(int i = 0; i < 1000000; i++){
+        sketch.insert(static_cast<int>(mt() % 1000000));
+        most = std::max(most, sketch.retained());
+    }
+    // 3k for the geometric levels and min_width for each of the about log2(n / k) lowest ones
+    EXPECT_LE(most, 3u * 100u + 8u * 14u);
+}
+
+TEST_F(KllSketchTest, Merge)
+{
+    // one sketch per thread of a split stream, merged into one
+    std::vector<int> stream = make_stream(200000, 1);
+    rtw::kll_sketch<int> merged;
+    for(int part = 0; part < 8; part++){
+        rtw::kll_sketch<int> sketch(rtw::kll_sketch<int>::default_k, std::less<int>(), part + 1);
+        for(std::size_t i = part; i < stream.size(); i += 8){
+            sketch.insert(stream[i]);
+        }
+        merged.merge(sketch);
+    }
+    EXPECT_EQ(stream.size(), merged.size());
+    EXPECT_EQ(0, merged.min());
+    EXPECT_EQ(199999, merged.max());
+    EXPECT_LE(max_rank_error(merged, stream), rtw::kll_sketch<int>::normalized_rank_error(merged.k()));
+    EXPECT_LE(merged.retained(), 3u * merged.k() + 8u * 16u);
+
+    rtw::kll_sketch<int> twice(merged);
+    twice.merge(twice);
+    EXPECT_EQ(2 * stream.size(), twice.size());
+    EXPECT_NEAR(0.5, twice.rank(100000), rtw::kll_sketch<int>::normalized_rank_error(twice.k()));
+}
+
+TEST_F(KllSketchTest, Compare)
+{
+    std::vector<int> stream = make_stream(100000, 2);
+    rtw::kll_sketch<int, std::greater<int>> sketch;
+    for(int x : stream){
+        sketch.insert(x);
+    }
+    EXPECT_EQ(99999, sketch.min());
+    EXPECT_EQ(0, sketch.max());
+    double error = rtw::kll_sketch<int>::normalized_rank_error(sketch.k());
+    EXPECT_NEAR(0.25, sketch.rank(74999), error);
+    EXPECT_NEAR(74999.0, sketch.quantile(0.25), error * 100000);
+}
+
+TEST_F(KllSketchTest, Duplicates)
+{
+    rtw::kll_sketch<double> sketch;
+    for(int i = 0; i < 100000; i++){
+        sketch.insert(static_cast<double>(i % 4));
+    }
+    double error = rtw::kll_sketch<double>::normalized_rank_error(sketch.k());
+    EXPECT_NEAR(0.5, sketch.rank(2.0), error);
+    EXPECT_EQ(1.0, sketch.quantile(0.4));
+    EXPECT_EQ(3.0, sketch.quantile(0.9));
+
+    sketch.clear();
+    EXPECT_TRUE(sketch.empty());
+    EXPECT_EQ(0u, sketch.retained());
+    sketch.insert(1.5);
+    EXPECT_EQ(1.5, sketch.quantile(0.5));
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <rtw/algorithm/kway_merge.hpp>
+#include <rtw/container/queue.hpp>
+
+#include <vector>
+#include <list>
+#include <random>
+#include <string>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+class KwayMergeTest : public ::testing::Test{
+protected:
+    KwayMergeTest() {}
+    virtual ~KwayMergeTest() {}
+    virtual void SetUp() override {}
+    virtual void TearDown() override {}
+};
+
+TEST_F(KwayMergeTest, Ranges)
+{
+    std::vector<std::vector<int>> runs{ { 1, 4, 7 }, {}, { 2, 5, 8, 9 }, { 3, 6 } };
+    std::vector<int> out;
+    rtw::kway_merge(runs.begin(), runs.end(), std::back_inserter(out));
+    EXPECT_TRUE((std::vector<int>{ 1, 2, 3, 4, 5, 6, 7, 8, 9 }) == out);
+
+    std::list<int> l1{ 9, 5, 1 };
+    std::list<int> l2{ 8, 3 };
+    std::vector<std::pair<std::list<int>::iterator, std::list<int>::iterator>> ranges{ { l1.begin(), l1.end() }, { l2.begin(), l2.end() } };
+    out.clear();
+    rtw::kway_merge(ranges.begin(), ranges.end(), std::back_inserter(out), std::greater<int>());
+    EXPECT_TRUE((std::vector<int>{ 9, 8, 5, 3, 1 }) == out);
+}
+
+TEST_F(KwayMergeTest, Sources)
+{
+    std::vector<rtw::queue<std::string>> sources(3);
+    sources[0].push("apple");
+    sources[0].push("fig");
+    sources[2].push("banana");
+    sources[2].push("cherry");
+    sources[2].push("grape");
+    std::vector<std::string> out(5);
+    auto end = rtw::kway_merge(sources.begin(), sources.end(), out.begin());
+    EXPECT_TRUE(end == out.end());
+    EXPECT_TRUE((std::vector<std::string>{ "apple", "banana", "cherry", "fig", "grape" }) == out);
+    for(const auto& source : sources){
+        EXPECT_TRUE(source.empty());
+    }
+}
+
+TEST_F(KwayMergeTest, SmallSize)
+{
+    std::vector<std::vector<int>> runs;
+    std::vector<int> out;
+    rtw::kway_merge(runs.begin(), runs.end(), std::back_inserter(out));
+    EXPECT_TRUE(out.empty());
+
+    runs.push_back({ 1, 2, 3 });
+    rtw::kway_merge(runs.begin(), runs.end(), std::back_inserter(out));
+    EXPECT_TRUE((std::vector<int>{ 1, 2, 3 }) == out);
+}
+
+TEST_F(KwayMergeTest, Stable)
+{
+    using value_type = std::pair<int, int>;
+    std::mt19937 engine(1);
+    std::vector<std::vector<value_type>> runs(7);
+    for(int r = 0; r < 7; ++r){
+        for(int i = 0; i < 100; ++i){
+            runs[r].emplace_back(static_cast<int>(engine() % 10), r);
+        }
+        std::sort(runs[r].begin(), runs[r].end());
+    }
+    std::vector<value_type> out;
+    rtw::kway_merge(runs.begin(), runs.end(), std::back_inserter(out), [](const value_type& lhs, const value_type& rhs) -> bool {
+        return lhs.first < rhs.first;
+    });
+    // equal keys come in the order of their runs
+    EXPECT_TRUE(std::is_sorted(out.begin(), out.end()));
+    EXPECT_EQ(700u, out.size());
+}
+
+TEST_F(KwayMergeTest, Comparisons)
+{
+    std::mt19937 engine(2);
+    const std::size_t k = 64;
+    const std::size_t n = 1000;
+    std::vector<std::vector<int>> runs(k);
+    for(auto& run : runs){
+        for(std::size_t i = 0; i < n; ++i){
+            run.push_back(static_cast<int>(engine()));
+        }
+        std::sort(run.begin(), run.end());
+    }
+    std::vector<int> expected;
+    for(const auto& run : runs){
+        expected.insert(expected.end(), run.begin(), run.end());
+    }
+    std::sort(expected.begin(), expected.end());
+
+    std::size_t comparisons = 0;
+    std::vector<int> out;
+    rtw::kway_merge(runs.begin(), runs.end(), std::back_inserter(out), [&comparisons](int lhs, int rhs) -> bool {
+        ++comparisons;
+        return lhs < rhs;
+    });
+    EXPECT_TRUE(expected == out);
+    // log2(64) = 6 comparisons per element plus the initial tournament
+    EXPECT_LE(comparisons, k * n * 6 + k);
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <rtw/container/loser_tree.hpp>
+
+#include <vector>
+#include <random>
+#include <functional>
+#include <algorithm>
+
+class LoserTreeTest : public ::testing::Test{
+protected:
+    LoserTreeTest() {}
+    virtual ~LoserTreeTest() {}
+    virtual void SetUp() override {}
+    virtual void TearDown() override {}
+};
+
+TEST_F(LoserTreeTest, Constructor)
+{
+    rtw::loser_tree<int> t0(3);
+    EXPECT_TRUE(t0.empty());
+    EXPECT_EQ(0u, t0.size());
+    EXPECT_EQ(3u, t0.sources());
+
+    std::vector<int> v{ 5, 2, 7, 2, 9 };
+    rtw::loser_tree<int> t1(v.begin(), v.end());
+    EXPECT_FALSE(t1.empty());
+    EXPECT_EQ(5u, t1.size());
+    EXPECT_EQ(2, t1.top());
+    EXPECT_EQ(1u, t1.top_source());
+
+    rtw::loser_tree<int, std::greater<int>> t2(v.begin(), v.end());
+    EXPECT_EQ(9, t2.top());
+    EXPECT_EQ(4u, t2.top_source());
+}
+
+TEST_F(LoserTreeTest, ReplaceTopAndPop)
+{
+    std::vector<int> v{ 5, 2, 7, 2, 9 };
+    rtw::loser_tree<int> t(v.begin(), v.end());
+    // ties are won by the smaller source
+    t.replace_top(6);
+    EXPECT_EQ(2, t.top());
+    EXPECT_EQ(3u, t.top_source());
+    t.pop();
+    EXPECT_EQ(4u, t.size());
+    EXPECT_EQ(5, t.top());
+    EXPECT_EQ(0u, t.top_source());
+    t.pop();
+    EXPECT_EQ(6, t.top());
+    t.replace_top(8);
+    EXPECT_EQ(7, t.top());
+    t.pop();
+    EXPECT_EQ(8, t.top());
+    EXPECT_EQ(1u, t.top_source());
+    t.pop();
+    EXPECT_EQ(9, t.top());
+    t.pop();
+    EXPECT_TRUE(t.empty());
+}
+
+TEST_F(LoserTreeTest, Push)
+{
+    rtw::loser_tree<int> t(4);
+    t.push(2, 30);
+    EXPECT_EQ(30, t.top());
+    t.push(0, 40);
+    t.push(3, 10);
+    EXPECT_EQ(3u, t.size());
+    EXPECT_EQ(10, t.top());
+    EXPECT_EQ(3u, t.top_source());
+    t.pop();
+    EXPECT_EQ(30, t.top());
+    t.push(3, 20);
+    EXPECT_EQ(20, t.top());
+    EXPECT_EQ(3u, t.top_source());
+}
+
+TEST_F(LoserTreeTest, Random)
+{
+    std::mt19937 engine(1);
+    for(std::size_t k = 1; k <= 33; ++k){
+        std::vector<int> keys(k);
+        std::vector<int> remaining(k);
+        for(std::size_t i = 0; i < k; ++i){
+            keys[i] = static_cast<int>(engine() % 100);
+            remaining[i] = 10;
+        }
+        rtw::loser_tree<int> t(keys.begin(), keys.end());
+        std::vector<int> out;
+        while(!t.empty()){
+            std::size_t s = t.top_source();
+            EXPECT_EQ(keys[s], t.top());
+            EXPECT_EQ(*std::min_element(keys.begin(), keys.end()), t.top());
+            out.push_back(t.top());
+            if(--remaining[s] == 0){
+                keys[s] = 1000;
+                t.pop();
+            }
+            else{
+                keys[s] += static_cast<int>(engine() % 10);
+                t.replace_top(keys[s]);
+            }
+        }
+        EXPECT_EQ(k * 10, out.size());
+        EXPECT_TRUE(std::is_sorted(out.begin(), out.end()));
+    }
+}
+
+TEST_F(LoserTreeTest, Swap)
+{
+    std::vector<int> v1{ 3, 1 };
+    std::vector<int> v2{ 4, 5, 6 };
+    rtw::loser_tree<int> t1(v1.begin(), v1.end());
+    rtw::loser_tree<int> t2(v2.begin(), v2.end());
+    swap(t1, t2);
+    EXPECT_EQ(4, t1.top());
+    EXPECT_EQ(3u, t1.size());
+    EXPECT_EQ(1, t2.top());
+    EXPECT_EQ(2u, t2.size());
+}
\ No newline at end of file
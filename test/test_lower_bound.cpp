@@ -6,6 +6,8 @@
 #include <deque>
 #include <forward_list>
 #include <list>
+#include <random>
+#include <algorithm>
 
 class LowerBoundTest : public ::testing::Test{
 protected:
@@ -97,4 +99,28 @@ TEST_F(LowerBoundTest, SmallSize)
 
     std::vector<int> v1{ 1 };
     EXPECT_TRUE(v1.begin() == rtw::lower_bound(v1.begin(), v1.end(), 1));
+}
+
+TEST_F(LowerBoundTest, EverySize)
+{
+    // the branchless search of random-access ranges against the standard one, with duplicates and values outside the range
+    std::mt19937 mt(0);
+    for(int size = 0; size < 200; size++){
+        std::vector<int> v(size);
+        for(auto& x : v){ x = static_cast<int>(mt() % (size / 2 + 1)); }
+        std::sort(v.begin(), v.end());
+        std::deque<int> d(v.begin(), v.end());
+        for(int value = -1; value <= size / 2 + 1; value++){
+            EXPECT_TRUE(std::lower_bound(v.begin(), v.end(), value) == rtw::lower_bound(v.begin(), v.end(), value));
+            EXPECT_TRUE(std::lower_bound(d.begin(), d.end(), value) == rtw::lower_bound(d.begin(), d.end(), value));
+            EXPECT_TRUE(std::lower_bound(v.rbegin(), v.rend(), value, std::greater<int>()) == rtw::lower_bound(v.rbegin(), v.rend(), value, std::greater<int>()));
+        }
+    }
+}
+
+TEST_F(LowerBoundTest, Constexpr)
+{
+    constexpr int a[5] = { 1, 2, 2, 2, 5 };
+    static_assert(rtw::lower_bound(a, a + 5, 2) == a + 1);
+    static_assert(rtw::lower_bound(a, a + 5, 6) == a + 5);
 }
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include <vector>
 #include <deque>
 #include <random>
+#include <utility>
+#include <algorithm>
 
 class MergeSortTest : public ::testing::Test{
 protected:
@@ -93,4 +95,54 @@ TEST_F(MergeSortTest, Random)
 
     rtw::merge_sort(v.begin(), v.end());
     EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+}
+
+TEST_F(MergeSortTest, LargeRandom)
+{
+    std::random_device rnd;
+    std::mt19937 mt(rnd());
+
+    for(int size : { 31, 32, 33, 64, 100, 1000, 4097, 100000 }){
+        std::vector<int> v(size);
+        for(int i = 0; i < size; i++){
+            v[i] = mt();
+        }
+        std::vector<int> expected(v);
+        std::sort(expected.begin(), expected.end());
+
+        rtw::merge_sort(v.begin(), v.end());
+        EXPECT_TRUE(expected == v);
+    }
+}
+
+TEST_F(MergeSortTest, Presorted)
+{
+    static const int size = 10000;
+    std::vector<int> ascending(size);
+    std::vector<int> descending(size);
+    for(int i = 0; i < size; i++){
+        ascending[i] = i;
+        descending[i] = size - i;
+    }
+    rtw::merge_sort(ascending.begin(), ascending.end());
+    EXPECT_TRUE(std::is_sorted(ascending.begin(), ascending.end()));
+    rtw::merge_sort(descending.begin(), descending.end());
+    EXPECT_TRUE(std::is_sorted(descending.begin(), descending.end()));
+}
+
+TEST_F(MergeSortTest, Stable)
+{
+    std::mt19937 mt(0);
+
+    static const int size = 10000;
+    std::deque<std::pair<int, int>> d(size);
+    for(int i = 0; i < size; i++){
+        d[i] = std::make_pair(static_cast<int>(mt() % 16), i);
+    }
+    std::vector<std::pair<int, int>> expected(d.begin(), d.end());
+    auto compare = [](const std::pair<int, int>& lhs, const std::pair<int, int>& rhs) -> bool { return lhs.first < rhs.first; };
+    std::stable_sort(expected.begin(), expected.end(), compare);
+
+    rtw::merge_sort(d.begin(), d.end(), compare);
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), d.begin()));
 }
\ No newline at end of file
@@ -91,4 +91,19 @@ TEST_F(MinMaxElementTest, EvenSize)
     std::vector<int> v4{ 2, 1, 3, 4 };
     auto v4_expected = std::pair<std::vector<int>::iterator, std::vector<int>::iterator>(v4.begin() + 1, v4.begin() + 3);
     EXPECT_TRUE(v4_expected == rtw::minmax_element(v4.begin(), v4.end()));
+}
+
+TEST_F(MinMaxElementTest, FirstOccurrence)
+{
+    std::list<int> l{ 3, 1, 5, 1, 5, 3, 5, 1 };
+    auto min = l.begin();
+    std::advance(min, 1);
+    auto max = l.begin();
+    std::advance(max, 2);
+    auto l_expected = std::pair<std::list<int>::iterator, std::list<int>::iterator>(min, max);
+    EXPECT_TRUE(l_expected == rtw::minmax_element(l.begin(), l.end()));
+
+    std::deque<int> d{ 2, 2, 2, 2, 2 };
+    auto d_expected = std::pair<std::deque<int>::iterator, std::deque<int>::iterator>(d.begin(), d.begin());
+    EXPECT_TRUE(d_expected == rtw::minmax_element(d.begin(), d.end()));
 }
\ No newline at end of file
@@ -97,4 +97,106 @@ TEST_F(NthElementTest, Random)
 
     rtw::nth_element(v.begin(), v.begin() + size / 2, v.end());
     EXPECT_TRUE(sorted[size / 2] == v[size / 2]);
+}
+
+// checks that [first, last) is partitioned around nth as it would be by a full sort
+template<typename RandomAccessIterator, typename Compare>
+bool is_nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, Compare compare)
+{
+    for(RandomAccessIterator it = first; it != nth; ++it){
+        if(compare(*nth, *it)){
+            return false;
+        }
+    }
+    for(RandomAccessIterator it = nth; it != last; ++it){
+        if(compare(*it, *nth)){
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_F(NthElementTest, Patterns)
+{
+    std::mt19937 mt(0);
+
+    static const int size = 100000;
+    std::vector<std::vector<int>> patterns(6, std::vector<int>(size));
+    for(int i = 0; i < size; i++){
+        patterns[0][i] = mt();
+        patterns[1][i] = mt() % 2;
+        patterns[2][i] = 7;
+        patterns[3][i] = i;
+        patterns[4][i] = i < size / 2 ? i : size - i;
+        patterns[5][i] = i % 16;
+    }
+    for(const std::vector<int>& pattern : patterns){
+        for(int position : { 0, 1, size / 10, size / 2, size - 100, size - 1 }){
+            std::vector<int> v(pattern);
+            long long comparisons = 0;
+            auto compare = [&comparisons](int lhs, int rhs) -> bool { ++comparisons; return lhs < rhs; };
+            rtw::nth_element(v.begin(), v.begin() + position, v.end(), compare);
+            EXPECT_TRUE(is_nth_element(v.begin(), v.begin() + position, v.end(), std::less<int>()));
+            EXPECT_LT(comparisons, 8LL * size);
+        }
+    }
+}
+
+TEST_F(NthElementTest, Adversary)
+{
+    // McIlroy's adversary for quicksort: values are decided lazily so that every pivot is as bad as possible
+    static const int size = 20000;
+    std::vector<int> value(size, size);
+    std::vector<int> v(size);
+    for(int i = 0; i < size; i++){
+        v[i] = i;
+    }
+    int solid = 0;
+    int candidate = 0;
+    long long comparisons = 0;
+    auto compare = [&](int x, int y) -> bool {
+        ++comparisons;
+        if(value[x] == size && value[y] == size){
+            value[x == candidate ? x : y] = solid++;
+        }
+        if(value[x] == size){
+            candidate = x;
+        }
+        else if(value[y] == size){
+            candidate = y;
+        }
+        return value[x] < value[y];
+    };
+    rtw::nth_element(v.begin(), v.begin() + size / 2, v.end(), compare);
+    EXPECT_LT(comparisons, 40LL * size);
+
+    // the values decided are a valid input for which the selection was right
+    for(int& x : value){
+        if(x == size){
+            x = solid++;
+        }
+    }
+    EXPECT_TRUE(is_nth_element(v.begin(), v.begin() + size / 2, v.end(), [&value](int x, int y) -> bool { return value[x] < value[y]; }));
+}
+
+TEST_F(NthElementTest, EveryPosition)
+{
+    std::mt19937 mt(0);
+
+    for(int size : { 2, 16, 17, 100, 700, 2000 }){
+        std::vector<int> v(size);
+        for(int i = 0; i < size; i++){
+            v[i] = mt() % (size / 2 + 1);
+        }
+        std::vector<int> sorted(v);
+        std::sort(sorted.begin(), sorted.end());
+        for(int position = 0; position < size; position += 1 + size / 50){
+            std::vector<int> w(v);
+            rtw::nth_element(w.begin(), w.begin() + position, w.end(), std::greater<int>());
+            EXPECT_EQ(sorted[size - 1 - position], w[position]);
+            std::deque<int> d(v.begin(), v.end());
+            rtw::nth_element(d.begin(), d.begin() + position, d.end());
+            EXPECT_EQ(sorted[position], d[position]);
+        }
+    }
 }
\ No newline at end of file
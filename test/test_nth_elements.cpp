@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <rtw/algorithm/order_statistic.hpp>
+
+#include <array>
+#include <vector>
+#include <deque>
+#include <random>
+#include <algorithm>
+
+class NthElementsTest : public ::testing::Test{
+protected:
+    NthElementsTest() {}
+    virtual ~NthElementsTest() {}
+    virtual void SetUp() override {}
+    virtual void TearDown() override {}
+};
+
+// every requested position holds the element of the sorted range, and the elements between two of them lie between their values
+template<typename Container>
+bool is_nth_elements(const Container& c, std::vector<int> positions)
+{
+    std::vector<typename Container::value_type> sorted(c.begin(), c.end());
+    std::sort(sorted.begin(), sorted.end());
+    std::sort(positions.begin(), positions.end());
+    int begin = 0;
+    for(int position : positions){
+        if(c[position] != sorted[position]){
+            return false;
+        }
+        for(int i = begin; i < position; i++){
+            if(c[position] < c[i] || (begin > 0 && c[i] < c[begin - 1])){
+                return false;
+            }
+        }
+        begin = position + 1;
+    }
+    for(int i = begin; i < static_cast<int>(c.size()); i++){
+        if(begin > 0 && c[i] < c[begin - 1]){
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_F(NthElementsTest, CStyleArray)
+{
+    int a[5] = { 4, 3, 1, 5, 2 };
+    int positions[2] = { 3, 1 };
+    rtw::nth_elements(a, a + 5, positions, positions + 2);
+    EXPECT_EQ(2, a[1]);
+    EXPECT_EQ(4, a[3]);
+}
+
+TEST_F(NthElementsTest, RandomAccessIterator)
+{
+    std::vector<int> positions{ 0, 2, 4 };
+
+    std::array<int, 5> a{ 4, 1, 3, 5, 2 };
+    rtw::nth_elements(a.begin(), a.end(), positions.begin(), positions.end());
+    EXPECT_TRUE(is_nth_elements(a, positions));
+
+    std::deque<int> d{ 4, 1, 3, 5, 2 };
+    rtw::nth_elements(d.begin(), d.end(), positions.begin(), positions.end());
+    EXPECT_TRUE(is_nth_elements(d, positions));
+}
+
+TEST_F(NthElementsTest, Compare)
+{
+    std::vector<int> v{ 6, 4, 1, 3, 5, 2 };
+    std::vector<std::size_t> positions{ 0, 5 };
+    rtw::nth_elements(v.begin(), v.end(), positions.begin(), positions.end(), std::greater<int>());
+    EXPECT_EQ(6, v[0]);
+    EXPECT_EQ(1, v[5]);
+}
+
+TEST_F(NthElementsTest, SmallSize)
+{
+    std::vector<int> positions{ 0 };
+    std::vector<int> v0{  };
+    rtw::nth_elements(v0.begin(), v0.end(), positions.begin(), positions.begin());
+
+    std::vector<int> v1{ 1 };
+    rtw::nth_elements(v1.begin(), v1.end(), positions.begin(), positions.end());
+    EXPECT_EQ(1, v1[0]);
+}
+
+TEST_F(NthElementsTest, Quantiles)
+{
+    std::mt19937 mt(0);
+
+    static const int size = 100000;
+    // p50, p90, p99, p99.9 and the maximum, twice and out of order
+    std::vector<int> positions{ size - 1, size / 2, size * 9 / 10, size * 99 / 100, size * 999 / 1000, size / 2 };
+    for(int keys : { 10, 1 << 30 }){
+        std::vector<int> v(size);
+        for(int i = 0; i < size; i++){
+            v[i] = mt() % keys;
+        }
+        rtw::nth_elements(v.begin(), v.end(), positions.begin(), positions.end());
+        EXPECT_TRUE(is_nth_elements(v, positions));
+    }
+}
+
+TEST_F(NthElementsTest, Comparisons)
+{
+    std::mt19937 mt(0);
+
+    static const int size = 100000;
+    std::vector<int> v(size);
+    for(int i = 0; i < size; i++){
+        v[i] = mt();
+    }
+    // a hundred percentiles cost a few full passes per halving of them, far less than a hundred selections
+    std::vector<int> positions;
+    for(int i = 0; i < 100; i++){
+        positions.push_back(size / 100 * i);
+    }
+    long long comparisons = 0;
+    auto compare = [&comparisons](int lhs, int rhs) -> bool { ++comparisons; return lhs < rhs; };
+    rtw::nth_elements(v.begin(), v.end(), positions.begin(), positions.end(), compare);
+    EXPECT_TRUE(is_nth_elements(v, positions));
+    EXPECT_LT(comparisons, 20LL * size);
+}
\ No newline at end of file
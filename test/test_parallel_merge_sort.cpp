@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <rtw/algorithm/parallel_merge_sort.hpp>
+
+#include <array>
+#include <vector>
+#include <deque>
+#include <random>
+#include <utility>
+
+class ParallelMergeSortTest : public ::testing::Test{
+protected:
+    ParallelMergeSortTest() {}
+    virtual ~ParallelMergeSortTest() {}
+    virtual void SetUp() override {}
+    virtual void TearDown() override {}
+};
+
+TEST_F(ParallelMergeSortTest, CoRank)
+{
+    int a[4] = { 1, 3, 3, 7 };
+    int b[4] = { 2, 3, 4, 8 };
+    // merged: 1(a) 2(b) 3(a) 3(a) 3(b) 4(b) 7(a) 8(b)
+    int expected[9] = { 0, 1, 1, 2, 3, 3, 3, 4, 4 };
+    for(int k = 0; k <= 8; k++){
+        EXPECT_EQ(expected[k], rtw::co_rank(k, a, 4, b, 4, std::less<int>()));
+    }
+    EXPECT_EQ(0, rtw::co_rank(2, a, 0, b, 4, std::less<int>()));
+    EXPECT_EQ(2, rtw::co_rank(2, a, 4, b, 0, std::less<int>()));
+}
+
+TEST_F(ParallelMergeSortTest, MergeMove)
+{
+    std::vector<int> a{ 1, 3, 5 };
+    std::vector<int> b{ 2, 3, 6, 7 };
+    std::vector<int> result(7);
+    rtw::merge_move(a.begin(), a.end(), b.begin(), b.end(), result.begin(), std::less<int>());
+    EXPECT_TRUE((std::vector<int>{ 1, 2, 3, 3, 5, 6, 7 }) == result);
+}
+
+TEST_F(ParallelMergeSortTest, CStyleArray)
+{
+    int a[5] = { 4, 3, 1, 5, 2 };
+    rtw::parallel_merge_sort(a, a + 5);
+    EXPECT_TRUE(std::is_sorted(a, a + 5));
+}
+
+TEST_F(ParallelMergeSortTest, RandomAccessIterator)
+{
+    std::array<int, 5> a{ 4, 1, 3, 5, 2 };
+    rtw::parallel_merge_sort(a.begin(), a.end());
+    EXPECT_TRUE(std::is_sorted(a.begin(), a.end()));
+
+    std::vector<int> v{ 6, 4, 1, 3, 5, 2 };
+    rtw::parallel_merge_sort(v.begin(), v.end());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+
+    std::deque<int> d{ 4, 1, 3, 5, 2 };
+    rtw::parallel_merge_sort(d.begin(), d.end());
+    EXPECT_TRUE(std::is_sorted(d.begin(), d.end()));
+}
+
+TEST_F(ParallelMergeSortTest, SmallSize)
+{
+    std::vector<int> v0{  };
+    rtw::parallel_merge_sort(v0.begin(), v0.end());
+    EXPECT_TRUE(std::is_sorted(v0.begin(), v0.end()));
+
+    std::vector<int> v1{ 1 };
+    rtw::parallel_merge_sort(v1.begin(), v1.end());
+    EXPECT_TRUE(std::is_sorted(v1.begin(), v1.end()));
+}
+
+TEST_F(ParallelMergeSortTest, Random)
+{
+    std::random_device rnd;
+    std::mt19937 mt(rnd());
+    rtw::thread_pool pool(4);
+
+    for(int size : { 1 << 13, (1 << 14) + 1, 100000, 1 << 18 }){
+        std::vector<int> v(size);
+        for(int i = 0; i < size; i++){
+            v[i] = mt();
+        }
+        std::vector<int> expected(v);
+        std::sort(expected.begin(), expected.end());
+
+        rtw::parallel_merge_sort(pool, v.begin(), v.end());
+        EXPECT_TRUE(expected == v);
+    }
+}
+
+TEST_F(ParallelMergeSortTest, Stable)
+{
+    std::mt19937 mt(0);
+    rtw::thread_pool pool(3);
+
+    static const int size = 300000;
+    std::deque<std::pair<int, int>> d(size);
+    for(int i = 0; i < size; i++){
+        d[i] = std::make_pair(static_cast<int>(mt() % 64), i);
+    }
+    std::vector<std::pair<int, int>> expected(d.begin(), d.end());
+    auto compare = [](const std::pair<int, int>& lhs, const std::pair<int, int>& rhs) -> bool { return lhs.first > rhs.first; };
+    std::stable_sort(expected.begin(), expected.end(), compare);
+
+    rtw::parallel_merge_sort(pool, d.begin(), d.end(), compare);
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), d.begin()));
+}
\ No newline at end of file
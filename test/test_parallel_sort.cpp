@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <rtw/algorithm/parallel_sort.hpp>
+
+#include <array>
+#include <vector>
+#include <deque>
+#include <random>
+#include <stdexcept>
+
+class ParallelSortTest : public ::testing::Test{
+protected:
+    ParallelSortTest() {}
+    virtual ~ParallelSortTest() {}
+    virtual void SetUp() override {}
+    virtual void TearDown() override {}
+};
+
+TEST_F(ParallelSortTest, CStyleArray)
+{
+    int a[5] = { 4, 3, 1, 5, 2 };
+    rtw::parallel_sort(a, a + 5);
+    EXPECT_TRUE(std::is_sorted(a, a + 5));
+}
+
+TEST_F(ParallelSortTest, RandomAccessIterator)
+{
+    std::array<int, 5> a{ 4, 1, 3, 5, 2 };
+    rtw::parallel_sort(a.begin(), a.end());
+    EXPECT_TRUE(std::is_sorted(a.begin(), a.end()));
+
+    std::vector<int> v{ 6, 4, 1, 3, 5, 2 };
+    rtw::parallel_sort(v.begin(), v.end());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+
+    std::deque<int> d{ 4, 1, 3, 5, 2 };
+    rtw::parallel_sort(d.begin(), d.end());
+    EXPECT_TRUE(std::is_sorted(d.begin(), d.end()));
+}
+
+TEST_F(ParallelSortTest, SmallSize)
+{
+    std::vector<int> v0{  };
+    rtw::parallel_sort(v0.begin(), v0.end());
+    EXPECT_TRUE(std::is_sorted(v0.begin(), v0.end()));
+
+    std::vector<int> v1{ 1 };
+    rtw::parallel_sort(v1.begin(), v1.end());
+    EXPECT_TRUE(std::is_sorted(v1.begin(), v1.end()));
+
+    std::vector<int> v2{ 2, 1 };
+    rtw::parallel_sort(v2.begin(), v2.end());
+    EXPECT_TRUE(std::is_sorted(v2.begin(), v2.end()));
+}
+
+TEST_F(ParallelSortTest, Random)
+{
+    std::random_device rnd;
+    std::mt19937 mt(rnd());
+
+    static const int size = 1 << 18;
+    std::vector<int> v(size);
+    for(int i = 0; i < size; i++){
+        v[i] = mt();
+    }
+    std::vector<int> expected(v);
+    std::sort(expected.begin(), expected.end());
+
+    rtw::parallel_sort(v.begin(), v.end());
+    EXPECT_TRUE(expected == v);
+}
+
+TEST_F(ParallelSortTest, CompareAndDuplicate)
+{
+    std::mt19937 mt(0);
+
+    static const int size = 1 << 18;
+    std::deque<int> d(size);
+    for(int i = 0; i < size; i++){
+        d[i] = mt() % 16;
+    }
+
+    rtw::parallel_sort(d.begin(), d.end(), std::greater<int>());
+    EXPECT_TRUE(std::is_sorted(d.begin(), d.end(), std::greater<int>()));
+}
+
+TEST_F(ParallelSortTest, SharedPool)
+{
+    std::mt19937 mt(0);
+    rtw::thread_pool pool(4);
+
+    static const int size = 1 << 17;
+    for(int n = 0; n < 3; n++){
+        std::vector<double> v(size);
+        for(int i = 0; i < size; i++){
+            v[i] = static_cast<double>(mt()) / mt.max();
+        }
+        rtw::parallel_sort(pool, v.begin(), v.end());
+        EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+    }
+}
+
+TEST_F(ParallelSortTest, Exception)
+{
+    static const int size = 1 << 17;
+    std::vector<int> v(size);
+    for(int i = 0; i < size; i++){
+        v[i] = size - i;
+    }
+    auto compare = [](const int& lhs, const int& rhs) -> bool {
+        if(lhs == 7 || rhs == 7){
+            throw std::runtime_error("compare");
+        }
+        return lhs < rhs;
+    };
+    EXPECT_THROW(rtw::parallel_sort(v.begin(), v.end(), compare), std::runtime_error);
+}
\ No newline at end of file
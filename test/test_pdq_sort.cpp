@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <rtw/algorithm/pdq_sort.hpp>
+
+#include <array>
+#include <vector>
+#include <deque>
+#include <random>
+#include <string>
+#include <algorithm>
+
+class PdqSortTest : public ::testing::Test{
+protected:
+    PdqSortTest() {}
+    virtual ~PdqSortTest() {}
+    virtual void SetUp() override {}
+    virtual void TearDown() override {}
+};
+
+template<typename T, typename Compare>
+void ExpectSorted(std::vector<T> v, Compare compare)
+{
+    std::vector<T> expected(v);
+    std::sort(expected.begin(), expected.end(), compare);
+    rtw::pdq_sort(v.begin(), v.end(), compare);
+    EXPECT_TRUE(expected == v);
+}
+
+TEST_F(PdqSortTest, CStyleArray)
+{
+    int a[5] = { 4, 3, 1, 5, 2 };
+    rtw::pdq_sort(a, a + 5);
+    EXPECT_TRUE(std::is_sorted(a, a + 5));
+}
+
+TEST_F(PdqSortTest, RandomAccessIterator)
+{
+    std::array<int, 5> a{ 4, 1, 3, 5, 2 };
+    rtw::pdq_sort(a.begin(), a.end());
+    EXPECT_TRUE(std::is_sorted(a.begin(), a.end()));
+
+    std::vector<int> v{ 6, 4, 1, 3, 5, 2 };
+    rtw::pdq_sort(v.begin(), v.end());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+
+    std::deque<int> d{ 4, 1, 3, 5, 2 };
+    rtw::pdq_sort(d.begin(), d.end());
+    EXPECT_TRUE(std::is_sorted(d.begin(), d.end()));
+}
+
+TEST_F(PdqSortTest, Compare)
+{
+    std::vector<int> v{ 6, 4, 1, 3, 5, 2 };
+    rtw::pdq_sort(v.begin(), v.end(), std::greater<int>());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end(), std::greater<int>()));
+}
+
+TEST_F(PdqSortTest, SmallSize)
+{
+    std::vector<int> v0{  };
+    rtw::pdq_sort(v0.begin(), v0.end());
+    EXPECT_TRUE(std::is_sorted(v0.begin(), v0.end()));
+
+    std::vector<int> v1{ 1 };
+    rtw::pdq_sort(v1.begin(), v1.end());
+    EXPECT_TRUE(std::is_sorted(v1.begin(), v1.end()));
+
+    std::vector<int> v2{ 2, 1 };
+    rtw::pdq_sort(v2.begin(), v2.end());
+    EXPECT_TRUE(std::is_sorted(v2.begin(), v2.end()));
+}
+
+TEST_F(PdqSortTest, Random)
+{
+    std::random_device rnd;
+    std::mt19937 mt(rnd());
+
+    for(int size : { 23, 24, 129, 1000, 100000 }){
+        std::vector<int> v(size);
+        for(int i = 0; i < size; i++){
+            v[i] = mt();
+        }
+        ExpectSorted(v, std::less<int>());
+        ExpectSorted(v, std::greater<int>());
+    }
+}
+
+TEST_F(PdqSortTest, LowCardinality)
+{
+    std::mt19937 mt(0);
+    static const int size = 100000;
+    for(int cardinality : { 1, 2, 3, 16 }){
+        std::vector<int> v(size);
+        for(int i = 0; i < size; i++){
+            v[i] = mt() % cardinality;
+        }
+        ExpectSorted(v, std::less<int>());
+
+        // counted comparisons stay close to linear when only a few keys are distinct
+        long long count = 0;
+        auto compare = [&count](int lhs, int rhs) -> bool { ++count; return lhs < rhs; };
+        rtw::pdq_sort(v.begin(), v.end(), compare);
+        EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+        EXPECT_LT(count, 8LL * size * cardinality);
+    }
+}
+
+TEST_F(PdqSortTest, Patterns)
+{
+    static const int size = 100000;
+    std::vector<int> sorted(size), reversed(size), organ_pipe(size), sawtooth(size), push_front(size);
+    for(int i = 0; i < size; i++){
+        sorted[i] = i;
+        reversed[i] = size - i;
+        organ_pipe[i] = i < size / 2 ? i : size - i;
+        sawtooth[i] = i % 1000;
+        push_front[i] = i + 1;
+    }
+    push_front[size - 1] = 0;
+
+    for(const std::vector<int>& v : { sorted, reversed, organ_pipe, sawtooth, push_front }){
+        ExpectSorted(v, std::less<int>());
+
+        // sorted and reversed input are detected by the partition, so they cost O(n) comparisons
+        long long count = 0;
+        auto compare = [&count](int lhs, int rhs) -> bool { ++count; return lhs < rhs; };
+        std::vector<int> copy(v);
+        rtw::pdq_sort(copy.begin(), copy.end(), compare);
+        EXPECT_TRUE(std::is_sorted(copy.begin(), copy.end()));
+        if(&v == &sorted){
+            EXPECT_LT(count, 4LL * size);
+        }
+    }
+}
+
+TEST_F(PdqSortTest, NonArithmetic)
+{
+    std::mt19937 mt(0);
+    static const int size = 10000;
+    std::vector<std::string> v(size);
+    for(int i = 0; i < size; i++){
+        v[i] = std::to_string(mt() % 500);
+    }
+    ExpectSorted(v, std::less<std::string>());
+}
\ No newline at end of file
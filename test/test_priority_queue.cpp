@@ -3,6 +3,9 @@
 
 #include <deque>
 #include <functional>
+#include <random>
+#include <vector>
+#include <algorithm>
 
 class PriorityQueueTest : public ::testing::Test{
 protected:
@@ -176,4 +179,31 @@ TEST_F(PriorityQueueTest, Swap)
     EXPECT_EQ(2, a.top());
     EXPECT_EQ(1, b.size());
     EXPECT_EQ(3, b.top());
+}
+
+TEST_F(PriorityQueueTest, Arity)
+{
+    std::mt19937 mt(0);
+    rtw::priority_queue<int, std::vector<int>, std::less<int>, 4> c4;
+    rtw::priority_queue<int, std::vector<int>, std::greater<int>, 8> c8;
+    std::vector<int> v(1000);
+    for(auto& x : v){
+        x = static_cast<int>(mt() % 500);
+        c4.push(x);
+        c8.push(x);
+    }
+    EXPECT_EQ(4, c4.arity);
+    EXPECT_EQ(1000, c4.size());
+    std::sort(v.begin(), v.end());
+    for(std::size_t i = 0; i < v.size(); i++){
+        EXPECT_EQ(v[v.size() - 1 - i], c4.top());
+        EXPECT_EQ(v[i], c8.top());
+        c4.pop();
+        c8.pop();
+    }
+    EXPECT_TRUE(c4.empty());
+    EXPECT_TRUE(c8.empty());
+
+    rtw::priority_queue<int, std::vector<int>, std::less<int>, 4> c(v.begin(), v.end());
+    EXPECT_EQ(499, c.top());
 }
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include <vector>
 #include <deque>
 #include <random>
+#include <string>
+#include <algorithm>
 
 class QuickSortTest : public ::testing::Test{
 protected:
@@ -85,6 +87,48 @@ TEST_F(QuickSortTest, PartitionPivot)
     }
 }
 
+TEST_F(QuickSortTest, BlockPartition)
+{
+    std::mt19937 mt(0);
+    for(int size : { 3, 4, 64, 129, 130, 1000, 4097 }){
+        for(int cardinality : { 1, 2, 10, 1 << 30 }){
+            std::vector<int> v(size);
+            for(int i = 0; i < size; i++){
+                v[i] = mt() % cardinality;
+            }
+            std::vector<int> sorted(v);
+            std::sort(sorted.begin(), sorted.end());
+
+            rtw::move_median_to_first(v.begin(), v.begin(), v.begin() + size / 2, v.end() - 1, std::less<int>());
+            int pivot = v[0];
+            auto cut = rtw::block_partition(v.begin(), v.end(), std::less<int>());
+            EXPECT_TRUE(v.begin() < cut && cut < v.end());
+            for(auto it = v.begin(); it != cut; ++it){
+                EXPECT_TRUE(*it <= pivot);
+            }
+            for(auto it = cut; it != v.end(); ++it){
+                EXPECT_TRUE(*it >= pivot);
+            }
+            std::sort(v.begin(), v.end());
+            EXPECT_TRUE(sorted == v);
+        }
+    }
+
+    // equal keys are split evenly
+    std::vector<int> equal(1000, 7);
+    auto cut = rtw::block_partition(equal.begin(), equal.end(), std::less<int>());
+    EXPECT_TRUE(cut - equal.begin() > 400 && equal.end() - cut > 400);
+}
+
+TEST_F(QuickSortTest, UseBlockPartition)
+{
+    EXPECT_TRUE((rtw::use_block_partition<int, std::less<int>>::value));
+    EXPECT_TRUE((rtw::use_block_partition<double, std::greater<double>>::value));
+    EXPECT_TRUE((rtw::use_block_partition<long, std::less<>>::value));
+    EXPECT_FALSE((rtw::use_block_partition<std::string, std::less<std::string>>::value));
+    EXPECT_FALSE((rtw::use_block_partition<int, bool(*)(int, int)>::value));
+}
+
 TEST_F(QuickSortTest, CStyleArray)
 {
     int a[5] = { 4, 3, 1, 5, 2 };
@@ -164,4 +208,26 @@ TEST_F(QuickSortTest, Random)
 
     rtw::quick_sort(v.begin(), v.end());
     EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+}
+
+TEST_F(QuickSortTest, LargeRandom)
+{
+    std::mt19937 mt(0);
+
+    static const int size = 100000;
+    for(int cardinality : { 2, 100, 1 << 30 }){
+        std::vector<long long> v(size);
+        for(int i = 0; i < size; i++){
+            v[i] = mt() % cardinality;
+        }
+        std::vector<long long> expected(v);
+        std::sort(expected.begin(), expected.end());
+
+        rtw::quick_sort(v.begin(), v.end());
+        EXPECT_TRUE(expected == v);
+
+        std::reverse(v.begin(), v.end());
+        rtw::quick_sort(v.begin(), v.end(), std::greater<long long>());
+        EXPECT_TRUE(std::is_sorted(v.begin(), v.end(), std::greater<long long>()));
+    }
 }
\ No newline at end of file
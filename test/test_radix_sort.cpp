@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <rtw/algorithm/radix_sort.hpp>
+
+#include <array>
+#include <vector>
+#include <deque>
+#include <random>
+#include <cstdint>
+#include <limits>
+
+class RadixSortTest : public ::testing::Test{
+protected:
+    RadixSortTest() {}
+    virtual ~RadixSortTest() {}
+    virtual void SetUp() override {}
+    virtual void TearDown() override {}
+};
+
+template<typename T, typename Generator>
+void RandomTest(Generator generator, int size)
+{
+    std::mt19937_64 mt(0);
+    std::vector<T> v(size);
+    for(int i = 0; i < size; i++){
+        v[i] = generator(mt);
+    }
+    std::vector<T> expected(v);
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<T> buffer(size);
+    rtw::radix_sort(v.begin(), v.end(), buffer.data());
+    EXPECT_TRUE(expected == v);
+}
+
+TEST_F(RadixSortTest, CStyleArray)
+{
+    int a[5] = { 4, 3, 1, 5, 2 };
+    rtw::radix_sort(a, a + 5);
+    EXPECT_TRUE(std::is_sorted(a, a + 5));
+}
+
+TEST_F(RadixSortTest, RandomAccessIterator)
+{
+    std::array<int, 5> a{ 4, 1, 3, 5, 2 };
+    rtw::radix_sort(a.begin(), a.end());
+    EXPECT_TRUE(std::is_sorted(a.begin(), a.end()));
+
+    std::vector<int> v{ 6, 4, 1, 3, 5, 2 };
+    rtw::radix_sort(v.begin(), v.end());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+
+    std::deque<int> d(1000);
+    for(int i = 0; i < 1000; i++){
+        d[i] = (i * 7919) % 1000 - 500;
+    }
+    rtw::radix_sort(d.begin(), d.end());
+    EXPECT_TRUE(std::is_sorted(d.begin(), d.end()));
+}
+
+TEST_F(RadixSortTest, SmallSize)
+{
+    std::vector<int> v0{  };
+    rtw::radix_sort(v0.begin(), v0.end());
+    EXPECT_TRUE(std::is_sorted(v0.begin(), v0.end()));
+
+    std::vector<int> v1{ 1 };
+    rtw::radix_sort(v1.begin(), v1.end());
+    EXPECT_TRUE(std::is_sorted(v1.begin(), v1.end()));
+
+    std::vector<int> v2{ 2, 1 };
+    rtw::radix_sort(v2.begin(), v2.end());
+    EXPECT_TRUE(std::is_sorted(v2.begin(), v2.end()));
+}
+
+TEST_F(RadixSortTest, SignedInteger)
+{
+    RandomTest<std::int8_t>([](std::mt19937_64& mt) -> std::int8_t { return static_cast<std::int8_t>(mt()); }, 1000);
+    RandomTest<std::int16_t>([](std::mt19937_64& mt) -> std::int16_t { return static_cast<std::int16_t>(mt()); }, 1000);
+    RandomTest<std::int32_t>([](std::mt19937_64& mt) -> std::int32_t { return static_cast<std::int32_t>(mt()); }, 10000);
+    RandomTest<std::int64_t>([](std::mt19937_64& mt) -> std::int64_t { return static_cast<std::int64_t>(mt()); }, 10000);
+}
+
+TEST_F(RadixSortTest, UnsignedInteger)
+{
+    RandomTest<std::uint8_t>([](std::mt19937_64& mt) -> std::uint8_t { return static_cast<std::uint8_t>(mt()); }, 1000);
+    RandomTest<std::uint32_t>([](std::mt19937_64& mt) -> std::uint32_t { return static_cast<std::uint32_t>(mt()); }, 10000);
+    RandomTest<std::uint64_t>([](std::mt19937_64& mt) -> std::uint64_t { return mt(); }, 10000);
+}
+
+TEST_F(RadixSortTest, FloatingPoint)
+{
+    RandomTest<float>([](std::mt19937_64& mt) -> float {
+        return std::uniform_real_distribution<float>(-1.0e6f, 1.0e6f)(mt);
+    }, 10000);
+    RandomTest<double>([](std::mt19937_64& mt) -> double {
+        return std::uniform_real_distribution<double>(-1.0e-3, 1.0e3)(mt);
+    }, 10000);
+
+    std::vector<double> v{ 0.5, -std::numeric_limits<double>::infinity(), 3.0, -2.0, 0.0, std::numeric_limits<double>::max(), -1.0e-300, std::numeric_limits<double>::infinity(), -7.5, std::numeric_limits<double>::lowest() };
+    v.resize(200, 1.0);
+    rtw::radix_sort(v.begin(), v.end());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+}
+
+TEST_F(RadixSortTest, TrivialPass)
+{
+    // only the lowest digit differs, so every other pass is skipped
+    RandomTest<std::uint64_t>([](std::mt19937_64& mt) -> std::uint64_t { return 0x1234567800000000ull | (mt() & 0xFF); }, 1000);
+    // only the highest digit differs
+    RandomTest<std::int32_t>([](std::mt19937_64& mt) -> std::int32_t { return static_cast<std::int32_t>((mt() & 0xFF) << 24); }, 1000);
+
+    std::vector<std::int64_t> v(1000, -42);
+    rtw::radix_sort(v.begin(), v.end());
+    EXPECT_TRUE(std::vector<std::int64_t>(1000, -42) == v);
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include <rtw/algorithm/sample_sort.hpp>
+
+#include <vector>
+#include <random>
+#include <string>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+
+class SampleSortTest : public ::testing::Test{
+protected:
+    SampleSortTest() {}
+    virtual ~SampleSortTest() {}
+    virtual void SetUp() override {}
+    virtual void TearDown() override {}
+};
+
+TEST_F(SampleSortTest, SampleSort)
+{
+    std::vector<int> v{ 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+    rtw::sample_sort(v.begin(), v.end());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+
+    rtw::sample_sort(v.begin(), v.end(), std::greater<int>());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end(), std::greater<int>()));
+}
+
+TEST_F(SampleSortTest, Random)
+{
+    std::mt19937 engine(1);
+    for(int size : { 8193, 20000, 100000, 300001 }){
+        std::vector<std::uint32_t> v(size);
+        for(auto& x : v){ x = engine(); }
+        std::vector<std::uint32_t> expected(v);
+        std::sort(expected.begin(), expected.end());
+        rtw::sample_sort(v.begin(), v.end());
+        EXPECT_TRUE(expected == v);
+    }
+}
+
+TEST_F(SampleSortTest, Duplicates)
+{
+    std::mt19937 engine(2);
+    for(int distinct : { 1, 2, 3, 17, 1000 }){
+        std::vector<std::int64_t> v(100000);
+        for(auto& x : v){ x = engine() % distinct; }
+        std::vector<std::int64_t> expected(v);
+        std::sort(expected.begin(), expected.end());
+        rtw::sample_sort(v.begin(), v.end());
+        EXPECT_TRUE(expected == v);
+    }
+}
+
+TEST_F(SampleSortTest, Presorted)
+{
+    std::vector<double> v(50000);
+    for(std::size_t i = 0; i < v.size(); ++i){ v[i] = static_cast<double>(i); }
+    std::vector<double> expected(v);
+    rtw::sample_sort(v.begin(), v.end());
+    EXPECT_TRUE(expected == v);
+
+    std::reverse(v.begin(), v.end());
+    rtw::sample_sort(v.begin(), v.end());
+    EXPECT_TRUE(expected == v);
+}
+
+TEST_F(SampleSortTest, String)
+{
+    std::mt19937 engine(3);
+    std::vector<std::string> v(20000);
+    for(auto& s : v){ s = std::to_string(engine() % 5000); }
+    std::vector<std::string> expected(v);
+    std::sort(expected.begin(), expected.end(), std::greater<std::string>());
+    rtw::sample_sort(v.begin(), v.end(), std::greater<std::string>());
+    EXPECT_TRUE(expected == v);
+}
+
+TEST_F(SampleSortTest, ParallelSampleSort)
+{
+    std::mt19937 engine(4);
+    rtw::thread_pool pool(4);
+    for(int size : { 100, 70000, 500000 }){
+        std::vector<int> v(size);
+        for(auto& x : v){ x = static_cast<int>(engine()); }
+        std::vector<int> expected(v);
+        std::sort(expected.begin(), expected.end());
+        rtw::parallel_sample_sort(pool, v.begin(), v.end());
+        EXPECT_TRUE(expected == v);
+    }
+
+    std::vector<int> v(200000);
+    for(auto& x : v){ x = static_cast<int>(engine() % 4); }
+    std::vector<int> expected(v);
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+    rtw::parallel_sample_sort(pool, v.begin(), v.end(), std::greater<int>());
+    EXPECT_TRUE(expected == v);
+}
\ No newline at end of file
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include <rtw/algorithm/order_statistic.hpp>
+#include <rtw/algorithm/simd_sort.hpp>
+#include <rtw/container/vector.hpp>
+
+#include <vector>
+#include <random>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+
+class SimdMinMaxElementTest : public ::testing::TestWithParam<rtw::simd_isa>{
+protected:
+    SimdMinMaxElementTest() {}
+    virtual ~SimdMinMaxElementTest() {}
+    virtual void SetUp() override
+    {
+        if(static_cast<int>(GetParam()) > static_cast<int>(rtw::detect_simd_isa())){
+            GTEST_SKIP() << "instruction set not supported by this CPU";
+        }
+        rtw::set_simd_isa(GetParam());
+    }
+    virtual void TearDown() override
+    {
+        rtw::set_simd_isa(rtw::detect_simd_isa());
+    }
+};
+
+// random, few distinct values, ascending, descending and constant inputs of sizes around the register widths and the block
+template<typename T>
+std::vector<std::vector<T>> make_extremum_inputs()
+{
+    std::mt19937_64 mt(0);
+    std::vector<std::vector<T>> inputs;
+    for(int size : { 1, 2, 3, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 1000, 4095, 4096, 4097, 8193, 20000 }){
+        for(int pattern = 0; pattern < 5; pattern++){
+            std::vector<T> v(size);
+            for(int i = 0; i < size; i++){
+                switch(pattern){
+                case 0: v[i] = std::is_floating_point<T>::value ? static_cast<T>(static_cast<std::int64_t>(mt()) / 1e6) : static_cast<T>(mt()); break;
+                case 1: v[i] = static_cast<T>(mt() % 4); break;
+                case 2: v[i] = static_cast<T>(i); break;
+                case 3: v[i] = static_cast<T>(size - i); break;
+                default: v[i] = static_cast<T>(7); break;
+                }
+            }
+            inputs.push_back(v);
+        }
+    }
+    return inputs;
+}
+
+// the first least and the first greatest element, like the scalar loops
+template<typename T>
+void expect_extremum_like_std()
+{
+    for(const std::vector<T>& v : make_extremum_inputs<T>()){
+        const T* first = v.data();
+        const T* last = v.data() + v.size();
+        const T* min = std::min_element(first, last);
+        const T* max = std::max_element(first, last);
+        EXPECT_EQ(min, rtw::min_element(first, last)) << "size " << v.size();
+        EXPECT_EQ(max, rtw::max_element(first, last)) << "size " << v.size();
+        EXPECT_TRUE(std::make_pair(min, max) == rtw::minmax_element(first, last)) << "size " << v.size();
+
+        EXPECT_EQ(max, rtw::min_element(first, last, std::greater<T>())) << "size " << v.size();
+        EXPECT_EQ(min, rtw::max_element(first, last, std::greater<T>())) << "size " << v.size();
+        EXPECT_TRUE(std::make_pair(max, min) == rtw::minmax_element(first, last, std::greater<T>())) << "size " << v.size();
+    }
+}
+
+TEST_P(SimdMinMaxElementTest, Int32)
+{
+    expect_extremum_like_std<std::int32_t>();
+}
+
+TEST_P(SimdMinMaxElementTest, UInt32)
+{
+    expect_extremum_like_std<std::uint32_t>();
+}
+
+TEST_P(SimdMinMaxElementTest, Int64)
+{
+    expect_extremum_like_std<std::int64_t>();
+}
+
+TEST_P(SimdMinMaxElementTest, Float)
+{
+    expect_extremum_like_std<float>();
+}
+
+TEST_P(SimdMinMaxElementTest, Double)
+{
+    expect_extremum_like_std<double>();
+}
+
+TEST_P(SimdMinMaxElementTest, FirstOccurrence)
+{
+    // the extremes repeat within a register, across the accumulators, across blocks and in the scalar tail
+    std::vector<std::int32_t> v(10001, 0);
+    for(std::size_t i : { 5, 6, 37, 4096, 4100, 9999, 10000 }){
+        v[i] = -1;
+    }
+    for(std::size_t i : { 3, 4, 70, 8192, 10000 }){
+        v[i] = 1;
+    }
+    const std::int32_t* first = v.data();
+    const std::int32_t* last = v.data() + v.size();
+    EXPECT_EQ(first + 5, rtw::min_element(first, last));
+    EXPECT_EQ(first + 3, rtw::max_element(first, last));
+    EXPECT_TRUE(std::make_pair(first + 5, first + 3) == rtw::minmax_element(first, last));
+
+    // the only extremum in the last block and in the tail
+    std::vector<double> d(8200, 0.0);
+    d[8199] = -1.0;
+    d[8195] = 1.0;
+    EXPECT_EQ(d.data() + 8199, rtw::min_element(d.data(), d.data() + d.size()));
+    EXPECT_EQ(d.data() + 8195, rtw::max_element(d.data(), d.data() + d.size()));
+}
+
+TEST_P(SimdMinMaxElementTest, Extremes)
+{
+    std::vector<std::int32_t> v(100, 0);
+    v[40] = INT32_MIN;
+    v[60] = INT32_MAX;
+    EXPECT_TRUE(std::make_pair(v.data() + 40, v.data() + 60) == rtw::minmax_element(v.data(), v.data() + v.size()));
+
+    std::vector<std::uint32_t> u(100, 1u << 31);
+    u[40] = 0;
+    u[60] = UINT32_MAX;
+    EXPECT_TRUE(std::make_pair(u.data() + 40, u.data() + 60) == rtw::minmax_element(u.data(), u.data() + u.size()));
+
+    std::vector<float> f(100, 0.0f);
+    f[40] = -INFINITY;
+    f[60] = INFINITY;
+    EXPECT_TRUE(std::make_pair(f.data() + 40, f.data() + 60) == rtw::minmax_element(f.data(), f.data() + f.size()));
+}
+
+TEST_P(SimdMinMaxElementTest, NaN)
+{
+    // a NaN leaves the order undefined and the scalar loop decides, as it does without the kernels
+    for(std::size_t position : { 0, 1, 17, 100, 4095, 4096, 9999 }){
+        std::vector<float> v(10000);
+        for(std::size_t i = 0; i < v.size(); i++){
+            v[i] = static_cast<float>((i * 7919) % 10007);
+        }
+        v[position] = NAN;
+        const float* first = v.data();
+        const float* last = v.data() + v.size();
+        EXPECT_EQ(std::min_element(first, last), rtw::min_element(first, last)) << "position " << position;
+        EXPECT_EQ(std::max_element(first, last), rtw::max_element(first, last)) << "position " << position;
+    }
+}
+
+TEST_P(SimdMinMaxElementTest, RtwVector)
+{
+    std::mt19937 mt(0);
+    rtw::vector<std::uint32_t> v;
+    for(int i = 0; i < 10000; i++){
+        v.push_back(mt() % 1000);
+    }
+    EXPECT_EQ(std::min_element(v.begin(), v.end()), rtw::min_element(v.begin(), v.end()));
+    EXPECT_EQ(std::max_element(v.begin(), v.end()), rtw::max_element(v.begin(), v.end()));
+}
+
+INSTANTIATE_TEST_SUITE_P(Isa, SimdMinMaxElementTest, ::testing::Values(rtw::simd_isa::scalar, rtw::simd_isa::sse2, rtw::simd_isa::avx2, rtw::simd_isa::avx512));
\ No newline at end of file
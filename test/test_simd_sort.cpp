@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <rtw/algorithm/intro_sort.hpp>
+#include <rtw/algorithm/order_statistic.hpp>
+#include <rtw/algorithm/simd_sort.hpp>
+#include <rtw/container/vector.hpp>
+
+#include <vector>
+#include <random>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+
+class SimdSortTest : public ::testing::TestWithParam<rtw::simd_isa>{
+protected:
+    SimdSortTest() {}
+    virtual ~SimdSortTest() {}
+    virtual void SetUp() override
+    {
+        if(static_cast<int>(GetParam()) > static_cast<int>(rtw::detect_simd_isa())){
+            GTEST_SKIP() << "instruction set not supported by this CPU";
+        }
+        rtw::set_simd_isa(GetParam());
+    }
+    virtual void TearDown() override
+    {
+        rtw::set_simd_isa(rtw::detect_simd_isa());
+    }
+};
+
+// random, few distinct values, ascending, descending and constant inputs of many sizes around the register widths
+template<typename T>
+std::vector<std::vector<T>> make_inputs()
+{
+    std::mt19937_64 mt(0);
+    std::vector<std::vector<T>> inputs;
+    for(int size : { 0, 1, 2, 3, 7, 8, 9, 15, 16, 17, 31, 32, 33, 64, 127, 128, 129, 255, 256, 1000, 1025, 4096, 100000 }){
+        for(int pattern = 0; pattern < 5; pattern++){
+            std::vector<T> v(size);
+            for(int i = 0; i < size; i++){
+                switch(pattern){
+                case 0: v[i] = std::is_floating_point<T>::value ? static_cast<T>(static_cast<std::int64_t>(mt()) / 1e6) : static_cast<T>(mt()); break;
+                case 1: v[i] = static_cast<T>(mt() % 4); break;
+                case 2: v[i] = static_cast<T>(i); break;
+                case 3: v[i] = static_cast<T>(size - i); break;
+                default: v[i] = static_cast<T>(7); break;
+                }
+            }
+            inputs.push_back(v);
+        }
+    }
+    return inputs;
+}
+
+template<typename T>
+void expect_sorted_like_std()
+{
+    for(const std::vector<T>& input : make_inputs<T>()){
+        std::vector<T> expected(input);
+        std::sort(expected.begin(), expected.end());
+        std::vector<T> v(input);
+        rtw::intro_sort(v.data(), v.data() + v.size());
+        EXPECT_TRUE(expected == v) << "size " << input.size();
+
+        std::sort(expected.begin(), expected.end(), std::greater<T>());
+        v = input;
+        rtw::intro_sort(v.data(), v.data() + v.size(), std::greater<T>());
+        EXPECT_TRUE(expected == v) << "size " << input.size();
+    }
+}
+
+template<typename T>
+void expect_nth_element_like_std()
+{
+    for(const std::vector<T>& input : make_inputs<T>()){
+        std::size_t size = input.size();
+        if(size > 4096){
+            continue;
+        }
+        std::vector<T> expected(input);
+        std::sort(expected.begin(), expected.end());
+        for(std::size_t k : { std::size_t(0), size / 3, size / 2, size - 1 }){
+            if(k >= size){
+                continue;
+            }
+            std::vector<T> v(input);
+            rtw::nth_element(v.data(), v.data() + k, v.data() + size);
+            EXPECT_EQ(expected[k], v[k]) << "size " << size << ", k " << k;
+            EXPECT_TRUE(std::all_of(v.begin(), v.begin() + k, [&](T x){ return !(v[k] < x); }));
+            EXPECT_TRUE(std::all_of(v.begin() + k + 1, v.end(), [&](T x){ return !(x < v[k]); }));
+
+            v = input;
+            rtw::nth_element(v.data(), v.data() + k, v.data() + size, std::greater<T>());
+            EXPECT_EQ(expected[size - 1 - k], v[k]) << "size " << size << ", k " << k;
+        }
+    }
+}
+
+TEST_P(SimdSortTest, Int32)
+{
+    expect_sorted_like_std<std::int32_t>();
+    expect_nth_element_like_std<std::int32_t>();
+}
+
+TEST_P(SimdSortTest, UInt32)
+{
+    expect_sorted_like_std<std::uint32_t>();
+    expect_nth_element_like_std<std::uint32_t>();
+}
+
+TEST_P(SimdSortTest, Int64)
+{
+    expect_sorted_like_std<std::int64_t>();
+    expect_nth_element_like_std<std::int64_t>();
+}
+
+TEST_P(SimdSortTest, Float)
+{
+    expect_sorted_like_std<float>();
+    expect_nth_element_like_std<float>();
+}
+
+TEST_P(SimdSortTest, Double)
+{
+    expect_sorted_like_std<double>();
+    expect_nth_element_like_std<double>();
+}
+
+TEST_P(SimdSortTest, Extremes)
+{
+    std::vector<std::int32_t> v{ INT32_MAX, INT32_MIN, 0, -1, INT32_MAX, 1, INT32_MIN };
+    rtw::intro_sort(v.data(), v.data() + v.size());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+
+    std::vector<float> f{ 1.0f, -INFINITY, INFINITY, 0.5f, -2.0f, INFINITY };
+    rtw::intro_sort(f.data(), f.data() + f.size());
+    EXPECT_TRUE(std::is_sorted(f.begin(), f.end()));
+}
+
+TEST_P(SimdSortTest, RtwVector)
+{
+    std::mt19937 mt(0);
+    rtw::vector<std::uint32_t> v;
+    for(int i = 0; i < 10000; i++){
+        v.push_back(mt());
+    }
+    rtw::intro_sort(v.begin(), v.end());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+}
+
+TEST_P(SimdSortTest, Dispatch)
+{
+    int a[3] = { 3, 1, 2 };
+    EXPECT_EQ(GetParam() >= rtw::simd_isa::avx2, rtw::simd_sort(a, a + 3));
+    EXPECT_EQ(rtw::simd_isa_level(), GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(Isa, SimdSortTest, ::testing::Values(rtw::simd_isa::scalar, rtw::simd_isa::sse2, rtw::simd_isa::avx2, rtw::simd_isa::avx512));
\ No newline at end of file
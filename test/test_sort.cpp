@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include <rtw/algorithm/sort.hpp>
+
+#include <vector>
+#include <deque>
+#include <random>
+#include <string>
+#include <utility>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+
+namespace{
+
+std::vector<rtw::sort_statistics> reported;
+
+void record(const rtw::sort_statistics& statistics)
+{
+    reported.push_back(statistics);
+}
+
+}
+
+class SortTest : public ::testing::Test{
+protected:
+    SortTest() {}
+    virtual ~SortTest() {}
+    virtual void SetUp() override {
+        reported.clear();
+        rtw::set_sort_statistics_hook(record);
+    }
+    virtual void TearDown() override {
+        rtw::set_sort_statistics_hook(nullptr);
+    }
+protected:
+    // sorts v with rtw::sort, checks the result against std::sort and returns the reported algorithm
+    template<typename T, typename Compare = std::less<T>>
+    rtw::sort_algorithm sort(std::vector<T>& v, Compare compare = Compare()) {
+        std::vector<T> expected(v);
+        std::sort(expected.begin(), expected.end(), compare);
+        std::size_t before = reported.size();
+        rtw::sort(v.begin(), v.end(), compare);
+        EXPECT_TRUE(expected == v);
+        EXPECT_EQ(before + 1, reported.size());
+        EXPECT_EQ(v.size(), reported.back().size);
+        return reported.back().algorithm;
+    }
+};
+
+TEST_F(SortTest, Sort)
+{
+    std::vector<int> v{ 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+    EXPECT_EQ(rtw::sort_algorithm::insertion_sort, sort(v));
+    EXPECT_EQ(rtw::sort_algorithm::insertion_sort, sort(v, std::greater<int>()));
+
+    std::deque<int> d{ 2, 1 };
+    rtw::sort(d.begin(), d.end());
+    EXPECT_TRUE((std::deque<int>{ 1, 2 }) == d);
+
+    std::vector<int> v0;
+    EXPECT_EQ(rtw::sort_algorithm::insertion_sort, sort(v0));
+}
+
+TEST_F(SortTest, Presorted)
+{
+    std::vector<double> v(10000);
+    for(std::size_t i = 0; i < v.size(); ++i){ v[i] = static_cast<double>(i / 3); }
+    EXPECT_EQ(rtw::sort_algorithm::already_sorted, sort(v));
+    EXPECT_EQ(0u, reported.back().descents);
+
+    std::reverse(v.begin(), v.end());
+    EXPECT_EQ(rtw::sort_algorithm::reversed, sort(v));
+
+    // a few elements out of place
+    std::mt19937 engine(1);
+    for(int i = 0; i < 5; ++i){
+        std::swap(v[engine() % v.size()], v[engine() % v.size()]);
+    }
+    EXPECT_EQ(rtw::sort_algorithm::tim_sort, sort(v));
+    EXPECT_EQ(rtw::sort_algorithm::reversed, sort(v, std::greater<double>()));
+    std::swap(v[10], v[5000]);
+    EXPECT_EQ(rtw::sort_algorithm::tim_sort, sort(v, std::greater<double>()));
+}
+
+TEST_F(SortTest, ValueType)
+{
+    std::mt19937_64 engine(2);
+    std::vector<std::string> s(2000);
+    for(auto& x : s){ x = std::to_string(engine() % 100000); }
+    EXPECT_EQ(rtw::sort_algorithm::string_sort, sort(s));
+
+    std::vector<std::uint64_t> u(10000);
+    for(auto& x : u){ x = engine(); }
+    EXPECT_EQ(rtw::sort_algorithm::radix_sort, sort(u));
+
+    // the vector kernels need pointers
+    std::vector<int> i(10000);
+    for(auto& x : i){ x = static_cast<int>(engine()); }
+    rtw::sort(i.data(), i.data() + i.size());
+    rtw::sort_algorithm expected = rtw::simd_isa_level() < rtw::simd_isa::avx2 ? rtw::sort_algorithm::radix_sort : rtw::sort_algorithm::simd_sort;
+    EXPECT_EQ(expected, reported.back().algorithm);
+    EXPECT_TRUE(std::is_sorted(i.begin(), i.end()));
+
+    std::vector<std::pair<int, int>> p(10000);
+    for(auto& x : p){ x = std::make_pair(static_cast<int>(engine() % 1000000), static_cast<int>(engine())); }
+    EXPECT_EQ(rtw::sort_algorithm::intro_sort, sort(p));
+}
+
+TEST_F(SortTest, Duplicates)
+{
+    std::mt19937 engine(3);
+    std::vector<std::pair<int, int>> p(10000);
+    for(auto& x : p){ x = std::make_pair(static_cast<int>(engine() % 4), 0); }
+    EXPECT_EQ(rtw::sort_algorithm::pdq_sort, sort(p));
+    EXPECT_GE(4u, reported.back().distinct);
+    EXPECT_EQ(static_cast<std::size_t>(rtw::sort_sample_values), reported.back().values);
+
+}
+
+TEST_F(SortTest, Large)
+{
+    std::mt19937_64 engine(4);
+    std::vector<double> v(rtw::sort_large_threshold);
+    for(auto& x : v){ x = static_cast<double>(engine()); }
+    auto compare = [](double lhs, double rhs) -> bool { return lhs < rhs; };
+    rtw::sort_statistics statistics = {};
+    EXPECT_EQ(rtw::sort_algorithm::sample_sort, rtw::sort_choose(v.begin(), v.end(), compare, statistics));
+}
+
+TEST_F(SortTest, Hook)
+{
+    EXPECT_EQ(record, rtw::set_sort_statistics_hook(nullptr));
+    std::vector<int> v{ 2, 1 };
+    rtw::sort(v.begin(), v.end());
+    EXPECT_TRUE(reported.empty());
+    EXPECT_STREQ("tim_sort", rtw::sort_algorithm_name(rtw::sort_algorithm::tim_sort));
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include <rtw/algorithm/sort_network.hpp>
+
+#include <array>
+#include <vector>
+#include <deque>
+#include <random>
+#include <string>
+#include <utility>
+#include <algorithm>
+
+class SortNetworkTest : public ::testing::Test{
+protected:
+    SortNetworkTest() {}
+    virtual ~SortNetworkTest() {}
+    virtual void SetUp() override {}
+    virtual void TearDown() override {}
+};
+
+// zero-one principle: a network sorts every input iff it sorts every sequence of zeros and ones
+template<std::size_t... N>
+bool sorts_zero_one(std::index_sequence<N...>)
+{
+    bool result = true;
+    auto check = [&result](auto network) -> void {
+        using network_type = decltype(network);
+        constexpr std::size_t size = network_type::size;
+        for(unsigned long bits = 0; bits < (1ul << size); ++bits){
+            std::array<int, size + 1> a{};
+            for(std::size_t i = 0; i < size; ++i){
+                a[i] = (bits >> i) & 1;
+            }
+            network_type::sort(a.begin());
+            result = result && std::is_sorted(a.begin(), a.begin() + size);
+        }
+    };
+    (check(rtw::sort_network<N>()), ...);
+    return result;
+}
+
+TEST_F(SortNetworkTest, ZeroOne)
+{
+    EXPECT_TRUE(sorts_zero_one(std::make_index_sequence<17>()));
+}
+
+TEST_F(SortNetworkTest, Comparators)
+{
+    EXPECT_EQ(0u, rtw::sort_network<1>::comparators);
+    EXPECT_EQ(1u, rtw::sort_network<2>::comparators);
+    EXPECT_EQ(3u, rtw::sort_network<3>::comparators);
+    EXPECT_EQ(5u, rtw::sort_network<4>::comparators);
+    EXPECT_EQ(19u, rtw::sort_network<8>::comparators);
+    EXPECT_EQ(63u, rtw::sort_network<16>::comparators);
+    EXPECT_EQ(191u, rtw::sort_network<32>::comparators);
+}
+
+TEST_F(SortNetworkTest, FixedSize)
+{
+    std::array<int, 5> a{ 4, 1, 3, 5, 2 };
+    rtw::sort_network<5>::sort(a.begin());
+    EXPECT_TRUE(std::is_sorted(a.begin(), a.end()));
+
+    double b[8] = { 0.5, -1.0, 3.0, 2.5, -7.0, 0.0, 1.0, 1.0 };
+    rtw::sort_network<8>::sort(b, std::greater<double>());
+    EXPECT_TRUE(std::is_sorted(b, b + 8, std::greater<double>()));
+}
+
+TEST_F(SortNetworkTest, Random)
+{
+    std::random_device rnd;
+    std::mt19937 mt(rnd());
+
+    for(int size = 0; size <= rtw::sort_network_max; size++){
+        for(int trial = 0; trial < 100; trial++){
+            std::vector<int> v(size);
+            for(int i = 0; i < size; i++){
+                v[i] = mt() % 16;
+            }
+            std::vector<int> expected(v);
+            std::sort(expected.begin(), expected.end());
+
+            rtw::sort_network_sort(v.begin(), v.end());
+            EXPECT_TRUE(expected == v);
+        }
+    }
+}
+
+TEST_F(SortNetworkTest, NonArithmetic)
+{
+    std::mt19937 mt(0);
+
+    for(int size = 0; size <= rtw::sort_network_max; size++){
+        std::deque<std::string> d(size);
+        for(int i = 0; i < size; i++){
+            d[i] = std::to_string(mt() % 1000);
+        }
+        std::vector<std::string> expected(d.begin(), d.end());
+        std::sort(expected.begin(), expected.end());
+
+        rtw::sort_network_sort(d.begin(), d.end());
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), d.begin()));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+#include <rtw/algorithm/static_btree.hpp>
+#include <rtw/container/vector.hpp>
+#include <rtw/simd/isa.hpp>
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+
+class StaticBtreeTest : public ::testing::TestWithParam<rtw::simd_isa>{
+protected:
+    StaticBtreeTest() {}
+    virtual ~StaticBtreeTest() {}
+    virtual void SetUp() override
+    {
+        if(static_cast<int>(GetParam()) > static_cast<int>(rtw::detect_simd_isa())){
+            GTEST_SKIP() << "instruction set not supported by this CPU";
+        }
+        rtw::set_simd_isa(GetParam());
+    }
+    virtual void TearDown() override
+    {
+        rtw::set_simd_isa(rtw::detect_simd_isa());
+    }
+};
+
+// the most keys a tree of height levels holds, B (B + 1)^(height - 1)
+std::size_t full_size(std::size_t B, std::size_t height)
+{
+    std::size_t size = B;
+    for(std::size_t h = 1; h < height; h++){
+        size *= B + 1;
+    }
+    return size;
+}
+
+// the sizes where the layers change: an exactly full tree of each height and one key either side of it, where a level
+// is added, and twice a full tree and one key, whose last internal node has a single child
+std::vector<std::size_t> boundary_sizes(std::size_t B, std::size_t max_height)
+{
+    std::vector<std::size_t> sizes{ 0, 1 };
+    for(std::size_t height = 1; height <= max_height; height++){
+        std::size_t full = full_size(B, height);
+        sizes.push_back(full - 1);
+        sizes.push_back(full);
+        sizes.push_back(full + 1);
+        sizes.push_back(2 * full + 1);
+    }
+    return sizes;
+}
+
+// keys in pairs three apart, searched for every value between them and one beyond either end
+template<typename T, std::size_t B, typename Compare = std::less<T>>
+void expect_boundaries_like_std(std::size_t max_height)
+{
+    Compare compare;
+    for(std::size_t size : boundary_sizes(B, max_height)){
+        std::vector<T> v;
+        for(std::size_t i = 0; i < size; i++){
+            v.push_back(static_cast<T>(3 * (i / 2) + 1));
+        }
+        std::sort(v.begin(), v.end(), compare);
+        rtw::static_btree<T, B, Compare> tree(v.begin(), v.end());
+        ASSERT_EQ(size, tree.size());
+        for(std::size_t rank = 0; rank < size; rank++){
+            EXPECT_EQ(v[rank], tree[rank]) << "size " << size;
+        }
+        for(std::size_t x = 0; x <= 3 * (size / 2) + 2; x++){
+            T value = static_cast<T>(x);
+            EXPECT_EQ(static_cast<std::size_t>(std::lower_bound(v.begin(), v.end(), value, compare) - v.begin()), tree.lower_bound(value)) << "size " << size;
+            EXPECT_EQ(static_cast<std::size_t>(std::upper_bound(v.begin(), v.end(), value, compare) - v.begin()), tree.upper_bound(value)) << "size " << size;
+            EXPECT_EQ(std::binary_search(v.begin(), v.end(), value, compare), tree.contains(value)) << "size " << size;
+        }
+    }
+}
+
+TEST_P(StaticBtreeTest, Empty)
+{
+    rtw::static_btree<int> tree;
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(0u, tree.height());
+    EXPECT_EQ(0u, tree.lower_bound(1));
+    EXPECT_EQ(0u, tree.upper_bound(1));
+    EXPECT_FALSE(tree.contains(1));
+}
+
+TEST_P(StaticBtreeTest, Height)
+{
+    // one more level exactly when a key is added to a full tree
+    for(std::size_t height = 1; height <= 4; height++){
+        std::vector<int> v(full_size(5, height));
+        EXPECT_EQ(height, (rtw::static_btree<int, 5>(v.begin(), v.end()).height()));
+        v.push_back(0);
+        EXPECT_EQ(height + 1, (rtw::static_btree<int, 5>(v.begin(), v.end()).height()));
+    }
+    for(std::size_t height = 1; height <= 8; height++){
+        std::vector<int> v(full_size(1, height));
+        EXPECT_EQ(height, (rtw::static_btree<int, 1>(v.begin(), v.end()).height()));
+    }
+    std::vector<int> v(full_size(16, 3) + 1);
+    EXPECT_EQ(4u, (rtw::static_btree<int, 16>(v.begin(), v.end()).height()));
+}
+
+TEST_P(StaticBtreeTest, Int32)
+{
+    expect_boundaries_like_std<std::int32_t, 16>(3);
+    expect_boundaries_like_std<std::int32_t, 64>(2);
+}
+
+TEST_P(StaticBtreeTest, UInt32)
+{
+    expect_boundaries_like_std<std::uint32_t, 32>(3);
+}
+
+TEST_P(StaticBtreeTest, Int64)
+{
+    expect_boundaries_like_std<std::int64_t, 8>(4);
+}
+
+TEST_P(StaticBtreeTest, Float)
+{
+    expect_boundaries_like_std<float, 16>(3);
+}
+
+TEST_P(StaticBtreeTest, Double)
+{
+    expect_boundaries_like_std<double, 8>(4);
+}
+
+TEST_P(StaticBtreeTest, PartialNode)
+{
+    // nodes that do not fill whole registers are searched by the comparison under every instruction set
+    expect_boundaries_like_std<std::int32_t, 1>(6);
+    expect_boundaries_like_std<std::int32_t, 6>(4);
+    expect_boundaries_like_std<std::int64_t, 3>(4);
+    expect_boundaries_like_std<double, 7>(3);
+}
+
+TEST_P(StaticBtreeTest, Compare)
+{
+    // no vector search, with the keys descending
+    expect_boundaries_like_std<std::int32_t, 7, std::greater<std::int32_t>>(3);
+    expect_boundaries_like_std<std::uint32_t, 16, std::greater<std::uint32_t>>(3);
+
+    std::vector<int> v{ 9, 7, 7, 3, 1 };
+    rtw::static_btree<int, 3, std::greater<int>> tree(v.begin(), v.end());
+    rtw::static_btree<int, 3, std::greater<int>> other;
+    swap(tree, other);
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(0u, tree.lower_bound(7));
+    EXPECT_EQ(2u, other.height());
+    EXPECT_TRUE(std::make_pair(std::size_t(1), std::size_t(3)) == other.equal_range(7));
+}
+
+TEST_P(StaticBtreeTest, Extremes)
+{
+    // the padding copies the greatest key, which may be the greatest value of the type
+    std::vector<std::int32_t> v{ INT32_MIN, INT32_MIN, -1, 0, 5, INT32_MAX, INT32_MAX };
+    rtw::static_btree<std::int32_t> tree(v.begin(), v.end());
+    EXPECT_EQ(0u, tree.lower_bound(INT32_MIN));
+    EXPECT_EQ(2u, tree.upper_bound(INT32_MIN));
+    EXPECT_EQ(5u, tree.lower_bound(INT32_MAX));
+    EXPECT_EQ(7u, tree.upper_bound(INT32_MAX));
+    EXPECT_TRUE(std::make_pair(std::size_t(3), std::size_t(4)) == tree.equal_range(0));
+}
+
+TEST_P(StaticBtreeTest, Convert)
+{
+    // keys converted from the value type of the range, into the padding and the internal layers as well
+    std::vector<int> v;
+    for(int i = 0; i < 300; i++){
+        v.push_back(i * 2 - 150);
+    }
+    rtw::static_btree<long long, 8> wide(v.begin(), v.end());
+    EXPECT_EQ(3u, wide.height());
+    EXPECT_EQ(0u, wide.lower_bound(-1000000000000LL));
+    EXPECT_EQ(75u, wide.lower_bound(0));
+    EXPECT_EQ(76u, wide.upper_bound(0));
+    EXPECT_EQ(300u, wide.lower_bound(1000000000000LL));
+    EXPECT_EQ(448LL, wide[299]);
+
+    const char* words[] = { "apple", "banana", "grape", "lemon", "pear" };
+    rtw::static_btree<std::string, 2> strings(words, words + 5);
+    EXPECT_EQ(2u, strings.height());
+    EXPECT_EQ(3u, strings.lower_bound("kiwi"));
+    EXPECT_TRUE(strings.contains("pear"));
+    EXPECT_FALSE(strings.contains("plum"));
+    EXPECT_EQ("grape", strings[2]);
+
+    rtw::vector<std::int32_t> sorted{ 1, 2, 3 };
+    rtw::static_btree<std::int32_t> tree(sorted);
+    EXPECT_EQ(1u, tree.lower_bound(2));
+}
+
+INSTANTIATE_TEST_SUITE_P(Isa, StaticBtreeTest, ::testing::Values(rtw::simd_isa::scalar, rtw::simd_isa::sse2, rtw::simd_isa::avx2, rtw::simd_isa::avx512));
\ No newline at end of file
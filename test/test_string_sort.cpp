@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <rtw/algorithm/string_sort.hpp>
+#include <rtw/container/vector.hpp>
+
+#include <vector>
+#include <deque>
+#include <random>
+#include <string>
+#include <string_view>
+#include <algorithm>
+
+class StringSortTest : public ::testing::Test{
+protected:
+    StringSortTest() {}
+    virtual ~StringSortTest() {}
+    virtual void SetUp() override {}
+    virtual void TearDown() override {}
+};
+
+// strings sharing long prefixes, with embedded zero bytes, empty strings and exact duplicates
+std::vector<std::string> make_prefix_heavy(int size, unsigned seed)
+{
+    std::mt19937 mt(seed);
+    const std::vector<std::string> prefixes{ "", "a", "https://www.example.com/", "https://www.example.com/products/", "XNAS.", std::string("ab\0cd", 5) };
+    std::vector<std::string> v(size);
+    for(int i = 0; i < size; i++){
+        std::string s = prefixes[mt() % prefixes.size()];
+        int length = mt() % 24;
+        for(int j = 0; j < length; j++){
+            s.push_back(static_cast<char>(mt() % 4 == 0 ? mt() % 256 : 'a' + mt() % 3));
+        }
+        v[i] = s;
+    }
+    return v;
+}
+
+TEST_F(StringSortTest, StdString)
+{
+    std::vector<std::string> v{ "banana", "apple", "", "app", "apple", "b", "applesauce" };
+    std::vector<std::string> expected(v);
+    std::sort(expected.begin(), expected.end());
+    rtw::string_sort(v.begin(), v.end());
+    EXPECT_TRUE(expected == v);
+}
+
+TEST_F(StringSortTest, RtwVector)
+{
+    std::vector<std::string> input = make_prefix_heavy(1000, 1);
+    rtw::vector<std::string> v(input.begin(), input.end());
+    std::sort(input.begin(), input.end());
+    rtw::string_sort(v.begin(), v.end());
+    EXPECT_TRUE(std::equal(input.begin(), input.end(), v.begin()));
+}
+
+TEST_F(StringSortTest, StringView)
+{
+    std::vector<std::string> storage = make_prefix_heavy(3000, 2);
+    std::vector<std::string_view> v(storage.begin(), storage.end());
+    std::vector<std::string_view> expected(v);
+    std::sort(expected.begin(), expected.end());
+    rtw::string_sort(v.data(), v.data() + v.size());
+    EXPECT_TRUE(expected == v);
+}
+
+TEST_F(StringSortTest, Key)
+{
+    struct record{
+        std::string symbol;
+        int quantity;
+    };
+    std::deque<record> d{ { "MSFT", 1 }, { "AAPL", 2 }, { "GOOG", 3 }, { "AAPL", 4 } };
+    rtw::string_sort(d.begin(), d.end(), [](const record& r) -> std::string_view { return r.symbol; });
+    EXPECT_EQ("AAPL", d[0].symbol);
+    EXPECT_EQ("AAPL", d[1].symbol);
+    EXPECT_EQ("GOOG", d[2].symbol);
+    EXPECT_EQ(3, d[2].quantity);
+    EXPECT_EQ("MSFT", d[3].symbol);
+}
+
+TEST_F(StringSortTest, SmallSize)
+{
+    std::vector<std::string> v0{  };
+    rtw::string_sort(v0.begin(), v0.end());
+    EXPECT_TRUE(v0.empty());
+
+    std::vector<std::string> v1{ "a" };
+    rtw::string_sort(v1.begin(), v1.end());
+    EXPECT_EQ("a", v1[0]);
+}
+
+TEST_F(StringSortTest, Random)
+{
+    for(int size : { 17, 100, 4095, 4096, 20000 }){
+        std::vector<std::string> v = make_prefix_heavy(size, size);
+        std::vector<std::string> expected(v);
+        std::sort(expected.begin(), expected.end());
+        rtw::string_sort(v.begin(), v.end());
+        EXPECT_TRUE(expected == v) << "size " << size;
+    }
+}
+
+TEST_F(StringSortTest, Duplicates)
+{
+    std::vector<std::string> v(10000, std::string(100, 'x'));
+    for(int i = 0; i < 10000; i += 7){
+        v[i].back() = 'w';
+    }
+    std::vector<std::string> expected(v);
+    std::sort(expected.begin(), expected.end());
+    rtw::string_sort(v.begin(), v.end());
+    EXPECT_TRUE(expected == v);
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include <rtw/thread/thread_pool.hpp>
+
+#include <atomic>
+#include <stdexcept>
+
+class ThreadPoolTest : public ::testing::Test{
+protected:
+    ThreadPoolTest() {}
+    virtual ~ThreadPoolTest() {}
+    virtual void SetUp() override {}
+    virtual void TearDown() override {}
+};
+
+TEST_F(ThreadPoolTest, Size)
+{
+    rtw::thread_pool pool1(1);
+    EXPECT_EQ(1, pool1.size());
+
+    rtw::thread_pool pool3(3);
+    EXPECT_EQ(3, pool3.size());
+
+    rtw::thread_pool pool0(0);
+    EXPECT_EQ(1, pool0.size());
+}
+
+TEST_F(ThreadPoolTest, TaskGroup)
+{
+    rtw::thread_pool pool(2);
+    rtw::task_group group(pool);
+    std::atomic<int> count(0);
+    for(int i = 0; i < 100; i++){
+        group.run([&count]() -> void { ++count; });
+    }
+    group.wait();
+    EXPECT_EQ(100, count.load());
+}
+
+TEST_F(ThreadPoolTest, NestedTask)
+{
+    rtw::thread_pool pool(2);
+    rtw::task_group group(pool);
+    std::atomic<int> count(0);
+    for(int i = 0; i < 10; i++){
+        group.run([&group, &count]() -> void {
+            for(int j = 0; j < 10; j++){
+                group.run([&count]() -> void { ++count; });
+            }
+            ++count;
+        });
+    }
+    group.wait();
+    EXPECT_EQ(110, count.load());
+}
+
+TEST_F(ThreadPoolTest, Exception)
+{
+    rtw::thread_pool pool(2);
+    rtw::task_group group(pool);
+    std::atomic<int> count(0);
+    group.run([]() -> void { throw std::runtime_error("task"); });
+    group.run([&count]() -> void { ++count; });
+    EXPECT_THROW(group.wait(), std::runtime_error);
+    EXPECT_EQ(1, count.load());
+    EXPECT_NO_THROW(group.wait());
+}
\ No newline at end of file
@@ -67,9 +67,139 @@ TEST_F(TimSortTest, CountRun)
     EXPECT_FALSE(descending);
 }
 
+TEST_F(TimSortTest, GallopLeft)
+{
+    int a[7] = { 1, 2, 2, 2, 5, 7, 9 };
+    EXPECT_EQ(1, rtw::gallop_left(2, a, 7, 0, std::less<int>()));
+    EXPECT_EQ(1, rtw::gallop_left(2, a, 7, 6, std::less<int>()));
+    EXPECT_EQ(0, rtw::gallop_left(0, a, 7, 3, std::less<int>()));
+    EXPECT_EQ(7, rtw::gallop_left(10, a, 7, 3, std::less<int>()));
+    EXPECT_EQ(5, rtw::gallop_left(6, a, 7, 0, std::less<int>()));
+}
+
+TEST_F(TimSortTest, GallopRight)
+{
+    int a[7] = { 1, 2, 2, 2, 5, 7, 9 };
+    EXPECT_EQ(4, rtw::gallop_right(2, a, 7, 0, std::less<int>()));
+    EXPECT_EQ(4, rtw::gallop_right(2, a, 7, 6, std::less<int>()));
+    EXPECT_EQ(0, rtw::gallop_right(0, a, 7, 3, std::less<int>()));
+    EXPECT_EQ(7, rtw::gallop_right(9, a, 7, 3, std::less<int>()));
+    EXPECT_EQ(5, rtw::gallop_right(6, a, 7, 6, std::less<int>()));
+}
+
 TEST_F(TimSortTest, CStyleArray)
 {
-    //int a[5] = { 4, 3, 1, 5, 2 };
-    //rtw::tim_sort(a, a + 5);
-    //EXPECT_TRUE(std::is_sorted(a, a + 5));
+    int a[5] = { 4, 3, 1, 5, 2 };
+    rtw::tim_sort(a, a + 5);
+    EXPECT_TRUE(std::is_sorted(a, a + 5));
+}
+
+TEST_F(TimSortTest, RandomAccessIterator)
+{
+    std::array<int, 5> a{ 4, 1, 3, 5, 2 };
+    rtw::tim_sort(a.begin(), a.end());
+    EXPECT_TRUE(std::is_sorted(a.begin(), a.end()));
+
+    std::vector<int> v{ 6, 4, 1, 3, 5, 2 };
+    rtw::tim_sort(v.begin(), v.end());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+
+    std::deque<int> d{ 4, 1, 3, 5, 2 };
+    rtw::tim_sort(d.begin(), d.end());
+    EXPECT_TRUE(std::is_sorted(d.begin(), d.end()));
+}
+
+TEST_F(TimSortTest, Compare)
+{
+    std::vector<int> v{ 6, 4, 1, 3, 5, 2 };
+    rtw::tim_sort(v.begin(), v.end(), std::greater<int>());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end(), std::greater<int>()));
+}
+
+TEST_F(TimSortTest, SmallSize)
+{
+    std::vector<int> v0{  };
+    rtw::tim_sort(v0.begin(), v0.end());
+    EXPECT_TRUE(std::is_sorted(v0.begin(), v0.end()));
+
+    std::vector<int> v1{ 1 };
+    rtw::tim_sort(v1.begin(), v1.end());
+    EXPECT_TRUE(std::is_sorted(v1.begin(), v1.end()));
+
+    std::vector<int> v2{ 2, 1 };
+    rtw::tim_sort(v2.begin(), v2.end());
+    EXPECT_TRUE(std::is_sorted(v2.begin(), v2.end()));
+}
+
+TEST_F(TimSortTest, Random)
+{
+    std::random_device rnd;
+    std::mt19937 mt(rnd());
+
+    for(int size : { 63, 64, 65, 1000, 2112, 100000 }){
+        std::vector<int> v(size);
+        for(int i = 0; i < size; i++){
+            v[i] = mt();
+        }
+        std::vector<int> expected(v);
+        std::sort(expected.begin(), expected.end());
+
+        rtw::tim_sort(v.begin(), v.end());
+        EXPECT_TRUE(expected == v);
+    }
+}
+
+TEST_F(TimSortTest, Presorted)
+{
+    std::mt19937 mt(0);
+    static const int size = 100000;
+
+    std::vector<int> sorted(size);
+    for(int i = 0; i < size; i++){
+        sorted[i] = i;
+    }
+    std::vector<int> v(sorted);
+    rtw::tim_sort(v.begin(), v.end());
+    EXPECT_TRUE(sorted == v);
+
+    std::vector<int> reversed(sorted.rbegin(), sorted.rend());
+    rtw::tim_sort(reversed.begin(), reversed.end());
+    EXPECT_TRUE(sorted == reversed);
+
+    std::vector<int> nearly(sorted);
+    for(int i = 0; i < size / 100; i++){
+        std::swap(nearly[mt() % size], nearly[mt() % size]);
+    }
+    rtw::tim_sort(nearly.begin(), nearly.end());
+    EXPECT_TRUE(sorted == nearly);
+
+    // appended time series: sorted blocks with small overlaps
+    std::vector<int> blocks;
+    for(int block = 0; block < 100; block++){
+        for(int i = 0; i < 1000; i++){
+            blocks.push_back(block * 900 + i);
+        }
+    }
+    std::vector<int> expected(blocks);
+    std::sort(expected.begin(), expected.end());
+    rtw::tim_sort(blocks.begin(), blocks.end());
+    EXPECT_TRUE(expected == blocks);
+}
+
+TEST_F(TimSortTest, Stable)
+{
+    std::mt19937 mt(0);
+    static const int size = 100000;
+
+    std::vector<std::pair<int, int>> v(size);
+    for(int i = 0; i < size; i++){
+        // long runs of equal keys make the merges gallop
+        v[i] = std::make_pair(static_cast<int>(i < size / 2 ? mt() % 100 : (i / 1000) % 100), i);
+    }
+    std::vector<std::pair<int, int>> expected(v);
+    auto compare = [](const std::pair<int, int>& lhs, const std::pair<int, int>& rhs) -> bool { return lhs.first < rhs.first; };
+    std::stable_sort(expected.begin(), expected.end(), compare);
+
+    rtw::tim_sort(v.begin(), v.end(), compare);
+    EXPECT_TRUE(expected == v);
 }
\ No newline at end of file
@@ -6,6 +6,8 @@
 #include <deque>
 #include <forward_list>
 #include <list>
+#include <random>
+#include <algorithm>
 
 class UpperBoundTest : public ::testing::Test{
 protected:
@@ -96,4 +98,28 @@ TEST_F(UpperBoundTest, SmallSize)
 
     std::vector<int> v1{ 1 };
     EXPECT_TRUE(v1.begin() + 1 == rtw::upper_bound(v1.begin(), v1.end(), 1));
+}
+
+TEST_F(UpperBoundTest, EverySize)
+{
+    // the branchless search of random-access ranges against the standard one, with duplicates and values outside the range
+    std::mt19937 mt(0);
+    for(int size = 0; size < 200; size++){
+        std::vector<int> v(size);
+        for(auto& x : v){ x = static_cast<int>(mt() % (size / 2 + 1)); }
+        std::sort(v.begin(), v.end());
+        std::deque<int> d(v.begin(), v.end());
+        for(int value = -1; value <= size / 2 + 1; value++){
+            EXPECT_TRUE(std::upper_bound(v.begin(), v.end(), value) == rtw::upper_bound(v.begin(), v.end(), value));
+            EXPECT_TRUE(std::upper_bound(d.begin(), d.end(), value) == rtw::upper_bound(d.begin(), d.end(), value));
+            EXPECT_TRUE(std::upper_bound(v.rbegin(), v.rend(), value, std::greater<int>()) == rtw::upper_bound(v.rbegin(), v.rend(), value, std::greater<int>()));
+        }
+    }
+}
+
+TEST_F(UpperBoundTest, Constexpr)
+{
+    constexpr int a[5] = { 1, 2, 2, 2, 5 };
+    static_assert(rtw::upper_bound(a, a + 5, 2) == a + 4);
+    static_assert(rtw::upper_bound(a, a + 5, 0) == a);
 }
\ No newline at end of file